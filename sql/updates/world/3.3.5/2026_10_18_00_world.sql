@@ -0,0 +1,4 @@
+DELETE FROM `command` WHERE `name`='debug conditions';
+INSERT INTO `command` (`name`,`help`) VALUES
+('debug conditions','Syntax: .debug conditions
+Shows how many condition lists and single conditions were evaluated since startup for every condition source type.');
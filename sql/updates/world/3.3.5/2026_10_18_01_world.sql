@@ -0,0 +1,4 @@
+DELETE FROM `command` WHERE `name`='debug allocators';
+INSERT INTO `command` (`name`,`help`) VALUES
+('debug allocators','Syntax: .debug allocators
+Shows live objects, total allocations and reserved memory of the pools used for spells, auras and aura effects.');
@@ -0,0 +1,4 @@
+DELETE FROM `command` WHERE `name`='debug playersaves';
+INSERT INTO `command` (`name`,`help`) VALUES
+('debug playersaves','Syntax: .debug playersaves
+Shows how many player saves ran since startup and how many database statements each part of the save queued.');
@@ -0,0 +1,5 @@
+DELETE FROM `command` WHERE `name`='debug opcodes';
+INSERT INTO `command` (`name`,`help`) VALUES
+('debug opcodes','Syntax: .debug opcodes [#count|on|off|reset]
+Shows calls, handler time and packet size of the #count (default 20) client opcodes that took the most time since the last reset.
+on/off enable or disable the profiler, reset clears the statistics of all threads.');
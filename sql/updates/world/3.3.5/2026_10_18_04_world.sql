@@ -0,0 +1,5 @@
+DELETE FROM `command` WHERE `name`='debug creatureupdates';
+INSERT INTO `command` (`name`,`help`) VALUES
+('debug creatureupdates','Syntax: .debug creatureupdates [#count|scripts|reset]
+Shows the #count (default 20) creature entries whose updates took the most map thread time since the last reset, split into AI, movement and SmartScript time.
+scripts lists the 20 most expensive script or AI names instead, reset clears the statistics. Needs CreatureUpdateProfiler.SampleRate to be set.');
@@ -0,0 +1,4 @@
+DELETE FROM `command` WHERE `name`='lookup player name';
+INSERT INTO `command` (`name`,`help`) VALUES
+('lookup player name','Syntax: .lookup player name $prefix [$limit]
+Searches characters whose name starts with $prefix, ignoring case.');
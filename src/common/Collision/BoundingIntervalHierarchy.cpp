@@ -250,10 +250,10 @@ bool BIH::writeToFile(FILE* wf) const
     check += fwrite(&bounds.low(), sizeof(float), 3, wf);
     check += fwrite(&bounds.high(), sizeof(float), 3, wf);
     check += fwrite(&treeSize, sizeof(uint32), 1, wf);
-    check += fwrite(&tree[0], sizeof(uint32), treeSize, wf);
+    check += fwrite(tree.data(), sizeof(uint32), treeSize, wf);
     count = objects.size();
     check += fwrite(&count, sizeof(uint32), 1, wf);
-    check += fwrite(&objects[0], sizeof(uint32), count, wf);
+    check += fwrite(objects.data(), sizeof(uint32), count, wf);
     return check == (3 + 3 + 2 + treeSize + count);
 }
 
@@ -266,14 +266,30 @@ bool BIH::readFromFile(FILE* rf)
     check += fread(&hi, sizeof(float), 3, rf);
     bounds = G3D::AABox(lo, hi);
     check += fread(&treeSize, sizeof(uint32), 1, rf);
-    tree.resize(treeSize);
-    check += fread(&tree[0], sizeof(uint32), treeSize, rf);
+    tree.clear();
+    std::vector<uint32>& treeData = tree.Storage();
+    treeData.resize(treeSize);
+    check += fread(treeData.data(), sizeof(uint32), treeSize, rf);
     check += fread(&count, sizeof(uint32), 1, rf);
-    objects.resize(count); // = new uint32[nObjects];
-    check += fread(&objects[0], sizeof(uint32), count, rf);
+    objects.clear();
+    std::vector<uint32>& objectData = objects.Storage();
+    objectData.resize(count); // = new uint32[nObjects];
+    check += fread(objectData.data(), sizeof(uint32), count, rf);
     return uint64(check) == uint64(3 + 3 + 1 + 1 + uint64(treeSize) + uint64(count));
 }
 
+bool BIH::readFromFile(VMAP::ModelFileReader& reader)
+{
+    uint32 treeSize = 0, count = 0;
+    G3D::Vector3 lo, hi;
+    if (!reader.Read(lo) || !reader.Read(hi))
+        return false;
+
+    bounds = G3D::AABox(lo, hi);
+    return reader.Read(treeSize) && reader.Read(tree, treeSize)
+        && reader.Read(count) && reader.Read(objects, count);
+}
+
 void BIH::BuildStats::updateLeaf(int depth, int n)
 {
     numLeaves++;
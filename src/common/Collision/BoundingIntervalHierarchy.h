@@ -23,6 +23,7 @@
 #include <G3D/AABox.h>
 
 #include "Define.h"
+#include "ModelStorage.h"
 
 #include <stdexcept>
 #include <vector>
@@ -72,8 +73,9 @@ class TC_COMMON_API BIH
             objects.clear();
             bounds = G3D::AABox::empty();
             // create space for the first node
-            tree.push_back(3u << 30u); // dummy leaf
-            tree.insert(tree.end(), 2, 0);
+            std::vector<uint32>& treeData = tree.Storage();
+            treeData.push_back(3u << 30u); // dummy leaf
+            treeData.insert(treeData.end(), 2, 0);
         }
     public:
         BIH() { init_empty(); }
@@ -104,11 +106,11 @@ class TC_COMMON_API BIH
             if (printStats)
                 stats.printStats();
 
-            objects.resize(dat.numPrims);
-            for (uint32 i=0; i<dat.numPrims; ++i)
-                objects[i] = dat.indices[i];
+            objects.clear();
+            objects.Storage().assign(dat.indices, dat.indices + dat.numPrims);
             //nObjects = dat.numPrims;
-            tree = tempTree;
+            tree.clear();
+            tree.Storage().swap(tempTree);
             delete[] dat.primBound;
             delete[] dat.indices;
         }
@@ -332,12 +334,96 @@ class TC_COMMON_API BIH
             }
         }
 
+        //! calls intersectCallback for every object stored in a leaf overlapping the box, until it returns false
+        template<typename IsectCallback>
+        void intersectBox(G3D::AABox const& box, IsectCallback& intersectCallback) const
+        {
+            if (!bounds.intersects(box))
+                return;
+
+            StackNode stack[MAX_STACK_SIZE];
+            int stackPos = 0;
+            int node = 0;
+
+            while (true) {
+                while (true)
+                {
+                    uint32 tn = tree[node];
+                    uint32 axis = (tn & (3 << 30)) >> 30;
+                    bool BVH2 = (tn & (1 << 29)) != 0;
+                    int offset = tn & ~(7 << 29);
+                    if (!BVH2)
+                    {
+                        if (axis < 3)
+                        {
+                            // "normal" interior node
+                            float tl = intBitsToFloat(tree[node + 1]);
+                            float tr = intBitsToFloat(tree[node + 2]);
+                            bool left = box.low()[axis] <= tl;
+                            bool right = box.high()[axis] >= tr;
+                            if (left && right)
+                            {
+                                // box overlaps both nodes, push back right node
+                                stack[stackPos].node = offset + 3;
+                                stackPos++;
+                                node = offset;
+                                continue;
+                            }
+                            if (left)
+                            {
+                                node = offset;
+                                continue;
+                            }
+                            if (right)
+                            {
+                                node = offset + 3;
+                                continue;
+                            }
+                            // box is between clip zones
+                            break;
+                        }
+                        else
+                        {
+                            // leaf - report all objects
+                            int n = tree[node + 1];
+                            while (n > 0) {
+                                if (!intersectCallback(objects[offset]))
+                                    return;
+                                --n;
+                                ++offset;
+                            }
+                            break;
+                        }
+                    }
+                    else // BVH2 node (empty space cut off left and right)
+                    {
+                        if (axis>2)
+                            return; // should not happen
+                        float tl = intBitsToFloat(tree[node + 1]);
+                        float tr = intBitsToFloat(tree[node + 2]);
+                        node = offset;
+                        if (tl > box.high()[axis] || tr < box.low()[axis])
+                            break;
+                        continue;
+                    }
+                } // traversal loop
+
+                // stack is empty?
+                if (stackPos == 0)
+                    return;
+                // move back up the stack
+                stackPos--;
+                node = stack[stackPos].node;
+            }
+        }
+
         bool writeToFile(FILE* wf) const;
         bool readFromFile(FILE* rf);
+        bool readFromFile(VMAP::ModelFileReader& reader);
 
     protected:
-        std::vector<uint32> tree;
-        std::vector<uint32> objects;
+        VMAP::ModelArray<uint32> tree;
+        VMAP::ModelArray<uint32> objects;
         G3D::AABox bounds;
 
         struct buildData
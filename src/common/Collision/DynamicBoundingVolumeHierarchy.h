@@ -0,0 +1,508 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DYNAMIC_BVH_H
+#define _DYNAMIC_BVH_H
+
+#include "Define.h"
+#include "Errors.h"
+#include <G3D/AABox.h>
+#include <G3D/BoundsTrait.h>
+#include <G3D/Ray.h>
+#include <G3D/Vector3.h>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Bounding volume hierarchy for moving objects.
+ *
+ * The tree is bulk loaded with median splits into leaves of up to LEAF_SIZE objects. Leaf bounds
+ * are stored as structure of arrays so one ray or point test covers a whole leaf and compiles to
+ * 4 wide SIMD code. Moving an object only rewrites its box and refits the affected nodes in a batch
+ * before the next query, inserted objects wait in unsorted leaves until the next rebuild.
+ */
+template<class T, class BoundsFunc = BoundsTrait<T>>
+class DynamicBVH
+{
+public:
+    static constexpr uint32 LEAF_SIZE = 4;
+
+    DynamicBVH() : _root(INVALID_INDEX), _changesSinceBuild(0) { }
+
+    void insert(T const& obj)
+    {
+        G3D::AABox bounds;
+        BoundsFunc::getBounds(obj, bounds);
+        if (_pending.empty() || _pending.back().Count == LEAF_SIZE)
+            _pending.emplace_back();
+
+        Leaf& leaf = _pending.back();
+        uint32 lane = leaf.Count++;
+        leaf.Objects[lane] = &obj;
+        leaf.SetLane(lane, bounds);
+        _locations[&obj] = { true, uint32(_pending.size() - 1), lane };
+        ++_changesSinceBuild;
+    }
+
+    void remove(T const& obj)
+    {
+        auto itr = _locations.find(&obj);
+        if (itr == _locations.end())
+            return;
+
+        Location location = itr->second;
+        _locations.erase(itr);
+        ++_changesSinceBuild;
+
+        if (location.Pending)
+        {
+            // keep pending leaves packed, move the last pending object into the hole
+            Leaf& last = _pending.back();
+            uint32 lastLane = last.Count - 1;
+            if (&_pending[location.Leaf] != &last || location.Lane != lastLane)
+                MoveLane(_pending[location.Leaf], location.Lane, last, lastLane, true, location.Leaf);
+
+            if (--last.Count == 0)
+                _pending.pop_back();
+            return;
+        }
+
+        Leaf& leaf = _leaves[location.Leaf];
+        uint32 lastLane = leaf.Count - 1;
+        if (location.Lane != lastLane)
+            MoveLane(leaf, location.Lane, leaf, lastLane, false, location.Leaf);
+        --leaf.Count;
+        MarkDirty(location.Leaf);
+    }
+
+    //! must be called after the bounds of a contained object changed, returns its previous bounds
+    G3D::AABox update(T const& obj)
+    {
+        auto itr = _locations.find(&obj);
+        ASSERT(itr != _locations.end());
+
+        Location const& location = itr->second;
+        Leaf& leaf = location.Pending ? _pending[location.Leaf] : _leaves[location.Leaf];
+        G3D::AABox previous = leaf.GetLane(location.Lane);
+        G3D::AABox bounds;
+        BoundsFunc::getBounds(obj, bounds);
+        leaf.SetLane(location.Lane, bounds);
+        if (!location.Pending)
+        {
+            MarkDirty(location.Leaf);
+            ++_changesSinceBuild;
+        }
+        return previous;
+    }
+
+    bool contains(T const& obj) const { return _locations.count(&obj) > 0; }
+    bool empty() const { return _locations.empty(); }
+    std::size_t size() const { return _locations.size(); }
+
+    //! refits keep the tree valid but each one makes it a bit looser
+    bool needsRebuild() const { return _changesSinceBuild > std::max<std::size_t>(size() / 4, 4) || _pending.size() > 1; }
+
+    //! bulk loads all objects into a new tree
+    void balance()
+    {
+        std::vector<BuildItem> items;
+        items.reserve(_locations.size());
+        for (std::vector<Leaf> const* leaves : { &_leaves, &_pending })
+            for (Leaf const& leaf : *leaves)
+                for (uint32 lane = 0; lane < leaf.Count; ++lane)
+                    items.push_back({ leaf.Objects[lane], leaf.GetLane(lane) });
+
+        _nodes.clear();
+        _leaves.clear();
+        _pending.clear();
+        _dirtyNodes.clear();
+        _changesSinceBuild = 0;
+        _root = items.empty() ? INVALID_INDEX : Build(items, 0, uint32(items.size()), INVALID_INDEX);
+    }
+
+    template<typename RayCallback>
+    void intersectRay(G3D::Ray const& ray, RayCallback& intersectCallback, float& maxDist, bool stopAtFirst = true)
+    {
+        Prepare();
+
+        RayData rayData(ray);
+        std::array<float, LEAF_SIZE> distances;
+        auto visitLeaf = [&](Leaf const& leaf)
+        {
+            uint32 hits = leaf.IntersectRay(rayData, maxDist, distances);
+            for (uint32 lane = 0; hits; ++lane, hits >>= 1)
+                if ((hits & 1) && distances[lane] <= maxDist)
+                    if (intersectCallback(ray, *leaf.Objects[lane], maxDist) && stopAtFirst)
+                        return true;
+            return false;
+        };
+
+        for (Leaf const& leaf : _pending)
+            if (visitLeaf(leaf))
+                return;
+
+        if (_root == INVALID_INDEX)
+            return;
+
+        std::array<uint32, MAX_STACK_SIZE> stack;
+        uint32 stackSize = 0;
+        if (_nodes[_root].IntersectRay(rayData, maxDist) <= maxDist)
+            stack[stackSize++] = _root;
+
+        while (stackSize)
+        {
+            Node const& node = _nodes[stack[--stackSize]];
+            if (node.Leaf != INVALID_INDEX)
+            {
+                if (visitLeaf(_leaves[node.Leaf]))
+                    return;
+                continue;
+            }
+
+            // visit the nearer child first so hits shorten the ray for the farther one
+            float leftDist = _nodes[node.Left].IntersectRay(rayData, maxDist);
+            float rightDist = _nodes[node.Right].IntersectRay(rayData, maxDist);
+            uint32 nearChild = node.Left, farChild = node.Right;
+            if (rightDist < leftDist)
+            {
+                std::swap(nearChild, farChild);
+                std::swap(leftDist, rightDist);
+            }
+
+            if (rightDist <= maxDist)
+                stack[stackSize++] = farChild;
+            if (leftDist <= maxDist)
+                stack[stackSize++] = nearChild;
+        }
+    }
+
+    template<typename IsectCallback>
+    void intersectPoint(G3D::Vector3 const& point, IsectCallback& intersectCallback)
+    {
+        Prepare();
+
+        auto visitLeaf = [&](Leaf const& leaf)
+        {
+            uint32 hits = leaf.ContainsPoint(point);
+            for (uint32 lane = 0; hits; ++lane, hits >>= 1)
+                if (hits & 1)
+                    intersectCallback(point, *leaf.Objects[lane]);
+        };
+
+        for (Leaf const& leaf : _pending)
+            visitLeaf(leaf);
+
+        if (_root == INVALID_INDEX)
+            return;
+
+        std::array<uint32, MAX_STACK_SIZE> stack;
+        uint32 stackSize = 0;
+        stack[stackSize++] = _root;
+        while (stackSize)
+        {
+            Node const& node = _nodes[stack[--stackSize]];
+            if (!node.ContainsPoint(point))
+                continue;
+
+            if (node.Leaf != INVALID_INDEX)
+                visitLeaf(_leaves[node.Leaf]);
+            else
+            {
+                stack[stackSize++] = node.Right;
+                stack[stackSize++] = node.Left;
+            }
+        }
+    }
+
+private:
+    static constexpr uint32 INVALID_INDEX = std::numeric_limits<uint32>::max();
+    // median splits keep the depth at log2 of the leaf count
+    static constexpr uint32 MAX_STACK_SIZE = 64;
+    // pending leaves are tested one by one, too many of them (grid loading) are worth a rebuild right away
+    static constexpr std::size_t MAX_PENDING_LEAVES = 16;
+
+    struct RayData
+    {
+        explicit RayData(G3D::Ray const& ray)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                Origin[axis] = ray.origin()[axis];
+                // a finite stand in for infinity keeps 0 * inf from producing NaN for rays parallel to an axis
+                float direction = ray.direction()[axis];
+                InvDirection[axis] = direction != 0.0f ? 1.0f / direction : std::copysign(1.0e30f, direction);
+            }
+        }
+
+        float Origin[3];
+        float InvDirection[3];
+    };
+
+    struct Leaf
+    {
+        Leaf() : Count(0)
+        {
+            for (uint32 lane = 0; lane < LEAF_SIZE; ++lane)
+            {
+                Objects[lane] = nullptr;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    Low[axis][lane] = 0.0f;
+                    High[axis][lane] = 0.0f;
+                }
+            }
+        }
+
+        void SetLane(uint32 lane, G3D::AABox const& bounds)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                Low[axis][lane] = bounds.low()[axis];
+                High[axis][lane] = bounds.high()[axis];
+            }
+        }
+
+        G3D::AABox GetLane(uint32 lane) const
+        {
+            return G3D::AABox(G3D::Vector3(Low[0][lane], Low[1][lane], Low[2][lane]), G3D::Vector3(High[0][lane], High[1][lane], High[2][lane]));
+        }
+
+        //! slab test of all lanes, returns a bit mask of hit lanes and their entry distances
+        uint32 IntersectRay(RayData const& ray, float maxDist, std::array<float, LEAF_SIZE>& distances) const
+        {
+            uint32 hits = 0;
+            for (uint32 lane = 0; lane < LEAF_SIZE; ++lane)
+            {
+                float tNear = 0.0f;
+                float tFar = maxDist;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    float t1 = (Low[axis][lane] - ray.Origin[axis]) * ray.InvDirection[axis];
+                    float t2 = (High[axis][lane] - ray.Origin[axis]) * ray.InvDirection[axis];
+                    tNear = std::max(tNear, std::min(t1, t2));
+                    tFar = std::min(tFar, std::max(t1, t2));
+                }
+                distances[lane] = tNear;
+                hits |= uint32(tNear <= tFar) << lane;
+            }
+            return hits & ((1u << Count) - 1);
+        }
+
+        uint32 ContainsPoint(G3D::Vector3 const& point) const
+        {
+            uint32 hits = 0;
+            for (uint32 lane = 0; lane < LEAF_SIZE; ++lane)
+            {
+                bool inside = true;
+                for (int axis = 0; axis < 3; ++axis)
+                    inside &= Low[axis][lane] <= point[axis] && point[axis] <= High[axis][lane];
+                hits |= uint32(inside) << lane;
+            }
+            return hits & ((1u << Count) - 1);
+        }
+
+        alignas(16) float Low[3][LEAF_SIZE];
+        alignas(16) float High[3][LEAF_SIZE];
+        T const* Objects[LEAF_SIZE];
+        uint32 Count;
+        uint32 Node = INVALID_INDEX;
+    };
+
+    struct Node
+    {
+        //! entry distance of the ray into the node bounds, or infinity if it misses within maxDist
+        float IntersectRay(RayData const& ray, float maxDist) const
+        {
+            float tNear = 0.0f;
+            float tFar = maxDist;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                float t1 = (Low[axis] - ray.Origin[axis]) * ray.InvDirection[axis];
+                float t2 = (High[axis] - ray.Origin[axis]) * ray.InvDirection[axis];
+                tNear = std::max(tNear, std::min(t1, t2));
+                tFar = std::min(tFar, std::max(t1, t2));
+            }
+            return tNear <= tFar && Low[0] <= High[0] ? tNear : std::numeric_limits<float>::infinity();
+        }
+
+        bool ContainsPoint(G3D::Vector3 const& point) const
+        {
+            return Low[0] <= point.x && point.x <= High[0]
+                && Low[1] <= point.y && point.y <= High[1]
+                && Low[2] <= point.z && point.z <= High[2];
+        }
+
+        void SetEmpty()
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                // inverted bounds mark nodes whose objects were all removed
+                Low[axis] = std::numeric_limits<float>::max();
+                High[axis] = std::numeric_limits<float>::lowest();
+            }
+        }
+
+        void Merge(float const (&low)[3], float const (&high)[3])
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                Low[axis] = std::min(Low[axis], low[axis]);
+                High[axis] = std::max(High[axis], high[axis]);
+            }
+        }
+
+        float Low[3];
+        float High[3];
+        uint32 Parent = INVALID_INDEX;
+        uint32 Left = INVALID_INDEX;
+        uint32 Right = INVALID_INDEX;
+        uint32 Leaf = INVALID_INDEX;
+        bool Dirty = false;
+    };
+
+    struct Location
+    {
+        bool Pending;
+        uint32 Leaf;
+        uint32 Lane;
+    };
+
+    struct BuildItem
+    {
+        T const* Object;
+        G3D::AABox Bounds;
+    };
+
+    void MoveLane(Leaf& to, uint32 toLane, Leaf& from, uint32 fromLane, bool pending, uint32 toLeaf)
+    {
+        to.Objects[toLane] = from.Objects[fromLane];
+        to.SetLane(toLane, from.GetLane(fromLane));
+        _locations[to.Objects[toLane]] = { pending, toLeaf, toLane };
+    }
+
+    void MarkDirty(uint32 leafIndex)
+    {
+        // parents always have lower indexes than their children, refitting in descending order handles each node once
+        for (uint32 node = _leaves[leafIndex].Node; node != INVALID_INDEX && !_nodes[node].Dirty; node = _nodes[node].Parent)
+        {
+            _nodes[node].Dirty = true;
+            _dirtyNodes.push_back(node);
+        }
+    }
+
+    void Prepare()
+    {
+        if (_pending.size() > MAX_PENDING_LEAVES)
+            balance();
+        else
+            Refit();
+    }
+
+    void Refit()
+    {
+        if (_dirtyNodes.empty())
+            return;
+
+        std::sort(_dirtyNodes.begin(), _dirtyNodes.end(), std::greater<>());
+        for (uint32 index : _dirtyNodes)
+        {
+            Node& node = _nodes[index];
+            RefitNode(node);
+            node.Dirty = false;
+        }
+        _dirtyNodes.clear();
+    }
+
+    void RefitNode(Node& node)
+    {
+        node.SetEmpty();
+        if (node.Leaf != INVALID_INDEX)
+        {
+            Leaf const& leaf = _leaves[node.Leaf];
+            for (uint32 lane = 0; lane < leaf.Count; ++lane)
+            {
+                float low[3] = { leaf.Low[0][lane], leaf.Low[1][lane], leaf.Low[2][lane] };
+                float high[3] = { leaf.High[0][lane], leaf.High[1][lane], leaf.High[2][lane] };
+                node.Merge(low, high);
+            }
+        }
+        else
+        {
+            node.Merge(_nodes[node.Left].Low, _nodes[node.Left].High);
+            node.Merge(_nodes[node.Right].Low, _nodes[node.Right].High);
+        }
+    }
+
+    uint32 Build(std::vector<BuildItem>& items, uint32 begin, uint32 end, uint32 parent)
+    {
+        uint32 nodeIndex = uint32(_nodes.size());
+        _nodes.emplace_back();
+        _nodes[nodeIndex].Parent = parent;
+
+        uint32 count = end - begin;
+        if (count <= LEAF_SIZE)
+        {
+            Leaf& leaf = _leaves.emplace_back();
+            uint32 leafIndex = uint32(_leaves.size() - 1);
+            leaf.Node = nodeIndex;
+            for (uint32 i = begin; i < end; ++i)
+            {
+                uint32 lane = leaf.Count++;
+                leaf.Objects[lane] = items[i].Object;
+                leaf.SetLane(lane, items[i].Bounds);
+                _locations[items[i].Object] = { false, leafIndex, lane };
+            }
+            _nodes[nodeIndex].Leaf = leafIndex;
+            RefitNode(_nodes[nodeIndex]);
+            return nodeIndex;
+        }
+
+        G3D::AABox centers(items[begin].Bounds.center());
+        for (uint32 i = begin + 1; i < end; ++i)
+            centers.merge(items[i].Bounds.center());
+
+        int axis = centers.extent().primaryAxis();
+        // split at a multiple of LEAF_SIZE so only the last leaf can be partially filled
+        uint32 leafCount = (count + LEAF_SIZE - 1) / LEAF_SIZE;
+        uint32 middle = begin + (leafCount / 2) * LEAF_SIZE;
+        std::nth_element(items.begin() + begin, items.begin() + middle, items.begin() + end, [axis](BuildItem const& left, BuildItem const& right)
+        {
+            return left.Bounds.center()[axis] < right.Bounds.center()[axis];
+        });
+
+        uint32 left = Build(items, begin, middle, nodeIndex);
+        uint32 right = Build(items, middle, end, nodeIndex);
+        Node& node = _nodes[nodeIndex];
+        node.Left = left;
+        node.Right = right;
+        RefitNode(node);
+        return nodeIndex;
+    }
+
+    std::vector<Node> _nodes;
+    std::vector<Leaf> _leaves;
+    std::vector<Leaf> _pending;
+    std::vector<uint32> _dirtyNodes;
+    std::unordered_map<T const*, Location> _locations;
+    uint32 _root;
+    std::size_t _changesSinceBuild;
+};
+
+#endif // _DYNAMIC_BVH_H
@@ -16,11 +16,10 @@
  */
 
 #include "DynamicTree.h"
-#include "BoundingIntervalHierarchyWrapper.h"
+#include "DynamicBoundingVolumeHierarchy.h"
 #include "GameObjectModel.h"
 #include "MapTree.h"
 #include "ModelIgnoreFlags.h"
-#include "RegularGrid.h"
 #include "Timer.h"
 #include "VMapFactory.h"
 #include "VMapManager2.h"
@@ -28,6 +27,9 @@
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
 
 using VMAP::ModelInstance;
 
@@ -37,54 +39,71 @@ int CHECK_TREE_PERIOD = 200;
 
 } // namespace
 
-template<> struct HashTrait< GameObjectModel>{
-    static size_t hashCode(GameObjectModel const& g) { return (size_t)(void*)&g; }
-};
-
-template<> struct PositionTrait< GameObjectModel> {
-    static void getPosition(GameObjectModel const& g, G3D::Vector3& p) { p = g.getPosition(); }
-};
-
 template<> struct BoundsTrait< GameObjectModel> {
     static void getBounds(GameObjectModel const& g, G3D::AABox& out) { out = g.getBounds();}
-    static void getBounds2(GameObjectModel const* g, G3D::AABox& out) { out = g->getBounds();}
 };
 
-/*
-static bool operator==(GameObjectModel const& mdl, GameObjectModel const& mdl2){
-    return &mdl == &mdl2;
-}
-*/
-
-typedef RegularGrid2D<GameObjectModel, BIHWrap<GameObjectModel> > ParentTree;
-
-struct DynTreeImpl : public ParentTree/*, public Intersectable*/
+struct DynTreeImpl : public DynamicBVH<GameObjectModel>
 {
     typedef GameObjectModel Model;
-    typedef ParentTree base;
+    typedef DynamicBVH<GameObjectModel> base;
+
+    // generation counters are kept per map grid, grids share counters modulo GENERATION_CELLS,
+    // a collision only causes a spurious invalidation
+    static constexpr int GENERATION_CELLS = 16;
+    static constexpr int GRID_COUNT = 64;
+    static constexpr float GRID_SIZE = 533.33333f;
 
     DynTreeImpl() :
         rebalance_timer(CHECK_TREE_PERIOD),
-        unbalanced_times(0)
+        generations()
     {
     }
 
     void insert(Model const& mdl)
     {
         base::insert(mdl);
-        ++unbalanced_times;
+        touch(mdl.getBounds());
     }
 
     void remove(Model const& mdl)
     {
         base::remove(mdl);
-        ++unbalanced_times;
+        touch(mdl.getBounds());
+    }
+
+    void relocate(Model const& mdl)
+    {
+        touch(base::update(mdl));
+        touch(mdl.getBounds());
+    }
+
+    static int computeGrid(float position)
+    {
+        return std::clamp(int(std::floor(position / GRID_SIZE)) + GRID_COUNT / 2, 0, GRID_COUNT - 1);
     }
 
-    void balance()
+    template<class Visitor>
+    static void visitGrids(float x1, float y1, float x2, float y2, Visitor&& visitor)
     {
-        base::balance();
-        unbalanced_times = 0;
+        int lowX = computeGrid(std::min(x1, x2)), highX = computeGrid(std::max(x1, x2));
+        int lowY = computeGrid(std::min(y1, y2)), highY = computeGrid(std::max(y1, y2));
+        for (int x = lowX; x <= highX; ++x)
+            for (int y = lowY; y <= highY; ++y)
+                visitor((x % GENERATION_CELLS) * GENERATION_CELLS + y % GENERATION_CELLS);
+    }
+
+    void touch(G3D::AABox const& bounds)
+    {
+        visitGrids(bounds.low().x, bounds.low().y, bounds.high().x, bounds.high().y, [&](int index) { ++generations[index]; });
+    }
+
+    uint32 getGeneration(float x1, float y1, float x2, float y2) const
+    {
+        // the sum grows whenever any of the counters does
+        uint32 generation = 0;
+        visitGrids(x1, y1, x2, y2, [&](int index) { generation += generations[index]; });
+        return generation;
     }
 
     void update(uint32 difftime)
@@ -96,13 +115,13 @@ struct DynTreeImpl : public ParentTree/*, public Intersectable*/
         if (rebalance_timer.Passed())
         {
             rebalance_timer.Reset(CHECK_TREE_PERIOD);
-            if (unbalanced_times > 0)
+            if (needsRebuild())
                 balance();
         }
     }
 
     TimeTracker rebalance_timer;
-    int unbalanced_times;
+    std::array<uint32, GENERATION_CELLS * GENERATION_CELLS> generations;
 };
 
 DynamicMapTree::DynamicMapTree() : impl(new DynTreeImpl()) { }
@@ -127,6 +146,22 @@ bool DynamicMapTree::contains(GameObjectModel const& mdl) const
     return impl->contains(mdl);
 }
 
+void DynamicMapTree::relocate(GameObjectModel const& mdl)
+{
+    impl->relocate(mdl);
+}
+
+void DynamicMapTree::invalidate(GameObjectModel const& mdl)
+{
+    if (impl->contains(mdl))
+        impl->touch(mdl.getBounds());
+}
+
+uint32 DynamicMapTree::getGeneration(float x1, float y1, float x2, float y2) const
+{
+    return impl->getGeneration(x1, y1, x2, y2);
+}
+
 void DynamicMapTree::balance()
 {
     impl->balance();
@@ -170,11 +205,11 @@ private:
 };
 
 bool DynamicMapTree::getIntersectionTime(const uint32 phasemask, const G3D::Ray& ray,
-                                         const G3D::Vector3& endPos, float& maxDist) const
+                                         const G3D::Vector3& /*endPos*/, float& maxDist) const
 {
     float distance = maxDist;
     DynamicTreeIntersectionCallback callback(phasemask);
-    impl->intersectRay(ray, callback, distance, endPos);
+    impl->intersectRay(ray, callback, distance);
     if (callback.didHit())
         maxDist = distance;
     return callback.didHit();
@@ -231,7 +266,7 @@ bool DynamicMapTree::isInLineOfSight(float x1, float y1, float z1, float x2, flo
 
     G3D::Ray r(v1, (v2-v1) / maxDist);
     DynamicTreeIntersectionCallback callback(phasemask);
-    impl->intersectRay(r, callback, maxDist, v2);
+    impl->intersectRay(r, callback, maxDist);
 
     return !callback.did_hit;
 }
@@ -241,7 +276,7 @@ float DynamicMapTree::getHeight(float x, float y, float z, float maxSearchDist,
     G3D::Vector3 v(x, y, z);
     G3D::Ray r(v, G3D::Vector3(0, 0, -1));
     DynamicTreeIntersectionCallback callback(phasemask);
-    impl->intersectZAllignedRay(r, callback, maxSearchDist);
+    impl->intersectRay(r, callback, maxSearchDist);
 
     if (callback.didHit())
         return v.z - maxSearchDist;
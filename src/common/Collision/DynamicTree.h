@@ -60,6 +60,13 @@ public:
     void insert(GameObjectModel const&);
     void remove(GameObjectModel const&);
     bool contains(GameObjectModel const&) const;
+    // must be called after the bounds of a contained model changed, refits are batched until the next query
+    void relocate(GameObjectModel const&);
+    // must be called when a contained model is enabled, disabled or changes phase in place
+    void invalidate(GameObjectModel const&);
+
+    // changes whenever collision inside the given rectangle may have changed, used to validate cached query results
+    uint32 getGeneration(float x1, float y1, float x2, float y2) const;
 
     void balance();
     void update(uint32 diff);
@@ -39,6 +39,15 @@ namespace VMAP
         VMAP_LOAD_RESULT_IGNORED
     };
 
+    //! one segment of a batched line of sight query, in world coordinates
+    struct LineOfSightQuery
+    {
+        float X1, Y1, Z1;
+        float X2, Y2, Z2;
+        uint32 PhaseMask = 0; // only used for gameobject collision (DynamicMapTree)
+        bool InLineOfSight = true;
+    };
+
     enum class LoadResult : uint8
     {
         Success,
@@ -180,6 +180,40 @@ namespace VMAP
         return true;
     }
 
+    void VMapManager2::isInLineOfSight(unsigned int mapId, std::vector<LineOfSightQuery>& queries, ModelIgnoreFlags ignoreFlags)
+    {
+        for (LineOfSightQuery& query : queries)
+            query.InLineOfSight = true;
+
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+            return;
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+            return;
+
+        std::vector<std::pair<Vector3, Vector3>> segments;
+        std::vector<std::size_t> queryIndexes;
+        segments.reserve(queries.size());
+        queryIndexes.reserve(queries.size());
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            LineOfSightQuery const& query = queries[i];
+            Vector3 pos1 = convertPositionToInternalRep(query.X1, query.Y1, query.Z1);
+            Vector3 pos2 = convertPositionToInternalRep(query.X2, query.Y2, query.Z2);
+            if (pos1 != pos2)
+            {
+                segments.emplace_back(pos1, pos2);
+                queryIndexes.push_back(i);
+            }
+        }
+
+        std::vector<bool> results;
+        instanceTree->second->isInLineOfSight(segments, results, ignoreFlags);
+        for (std::size_t i = 0; i < queryIndexes.size(); ++i)
+            queries[queryIndexes[i]].InLineOfSight = results[i];
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
@@ -27,11 +27,14 @@
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <algorithm>
 
 using G3D::Vector3;
 
 namespace VMAP
 {
+    static constexpr std::size_t MAX_PACKET_CANDIDATES = 64;
+
     class MapRayCallback
     {
         public:
@@ -139,6 +142,100 @@ namespace VMAP
 
         return true;
     }
+    //=========================================================
+    /**
+    Line of sight for a packet of segments close to each other (area target selection)
+    The tree is walked once for the bounding box of all segments, afterwards each segment
+    is only tested against the bounds of the collected model instances
+    */
+    void StaticMapTree::isInLineOfSight(std::vector<std::pair<Vector3, Vector3>> const& segments, std::vector<bool>& results, ModelIgnoreFlags ignoreFlags) const
+    {
+        results.assign(segments.size(), true);
+        if (segments.empty())
+            return;
+
+        G3D::AABox packetBound(segments.front().first.min(segments.front().second), segments.front().first.max(segments.front().second));
+        for (std::pair<Vector3, Vector3> const& segment : segments)
+        {
+            packetBound.merge(segment.first);
+            packetBound.merge(segment.second);
+        }
+
+        std::vector<ModelInstance const*> candidates;
+        auto collectCandidate = [&](uint32 entry)
+        {
+            if (iTreeValues[entry].getWorldModel())
+                candidates.push_back(&iTreeValues[entry]);
+            return candidates.size() <= MAX_PACKET_CANDIDATES;
+        };
+        iTree.intersectBox(packetBound, collectCandidate);
+        if (candidates.empty())
+            return;
+
+        // with many instances in the area a separate tree walk per segment prunes better than the flat loop
+        if (candidates.size() > MAX_PACKET_CANDIDATES)
+        {
+            for (std::size_t s = 0; s < segments.size(); ++s)
+                results[s] = isInLineOfSight(segments[s].first, segments[s].second, ignoreFlags);
+            return;
+        }
+
+        // candidate bounds as separate arrays so the overlap test below is a plain loop over floats
+        std::size_t const candidateCount = candidates.size();
+        std::vector<float> bounds(candidateCount * 6);
+        float* low[3] = { &bounds[0], &bounds[candidateCount], &bounds[candidateCount * 2] };
+        float* high[3] = { &bounds[candidateCount * 3], &bounds[candidateCount * 4], &bounds[candidateCount * 5] };
+        for (std::size_t i = 0; i < candidateCount; ++i)
+        {
+            G3D::AABox const& bound = candidates[i]->getBounds();
+            for (uint32 axis = 0; axis < 3; ++axis)
+            {
+                low[axis][i] = bound.low()[axis];
+                high[axis][i] = bound.high()[axis];
+            }
+        }
+
+        std::vector<uint8> overlaps(candidateCount);
+        for (std::size_t s = 0; s < segments.size(); ++s)
+        {
+            Vector3 const& pos1 = segments[s].first;
+            Vector3 const& pos2 = segments[s].second;
+            float maxDist = (pos2 - pos1).magnitude();
+            // same special cases as the single segment version
+            if (maxDist == std::numeric_limits<float>::max() || !std::isfinite(maxDist))
+            {
+                results[s] = false;
+                continue;
+            }
+
+            if (maxDist < 1e-10f)
+                continue;
+
+            // only instances whose bounds overlap the bounds of the segment can block it,
+            // the exact ray/bound test is done by ModelInstance::intersectRay
+            Vector3 const segmentLow = pos1.min(pos2);
+            Vector3 const segmentHigh = pos1.max(pos2);
+            for (std::size_t i = 0; i < candidateCount; ++i)
+                overlaps[i] = (low[0][i] <= segmentHigh.x) & (high[0][i] >= segmentLow.x)
+                    & (low[1][i] <= segmentHigh.y) & (high[1][i] >= segmentLow.y)
+                    & (low[2][i] <= segmentHigh.z) & (high[2][i] >= segmentLow.z);
+
+            G3D::Ray ray = G3D::Ray::fromOriginAndDirection(pos1, (pos2 - pos1) / maxDist);
+            for (std::size_t i = 0; i < candidateCount; ++i)
+            {
+                if (!overlaps[i])
+                    continue;
+
+                float distance = maxDist;
+                if (candidates[i]->intersectRay(ray, distance, true, ignoreFlags))
+                {
+                    results[s] = false;
+                    break;
+                }
+            }
+        }
+    }
+
     //=========================================================
     /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
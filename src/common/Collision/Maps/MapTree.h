@@ -77,6 +77,7 @@ namespace VMAP
             ~StaticMapTree();
 
             bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2, ModelIgnoreFlags ignoreFlags) const;
+            void isInLineOfSight(std::vector<std::pair<G3D::Vector3, G3D::Vector3>> const& segments, std::vector<bool>& results, ModelIgnoreFlags ignoreFlags) const;
             bool getObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
             float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
             bool GetLocationInfo(const G3D::Vector3 &pos, LocationInfo &info) const;
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ModelStorage.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace VMAP
+{
+    struct MappedModelFile::Mapping
+    {
+        boost::interprocess::file_mapping File;
+        boost::interprocess::mapped_region Region;
+    };
+
+    MappedModelFile::MappedModelFile(std::unique_ptr<Mapping> mapping) : _mapping(std::move(mapping)),
+        _address(_mapping->Region.get_address()), _size(_mapping->Region.get_size())
+    {
+    }
+
+    MappedModelFile::~MappedModelFile() = default;
+
+    std::shared_ptr<MappedModelFile const> MappedModelFile::Open(std::string const& filename)
+    {
+        try
+        {
+            std::unique_ptr<Mapping> mapping = std::make_unique<Mapping>();
+            mapping->File = boost::interprocess::file_mapping(filename.c_str(), boost::interprocess::read_only);
+            mapping->Region = boost::interprocess::mapped_region(mapping->File, boost::interprocess::read_only);
+            return std::shared_ptr<MappedModelFile const>(new MappedModelFile(std::move(mapping)));
+        }
+        catch (boost::interprocess::interprocess_exception const&)
+        {
+            // missing, unreadable or empty file
+            return nullptr;
+        }
+    }
+}
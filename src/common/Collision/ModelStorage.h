@@ -0,0 +1,176 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MODELSTORAGE_H
+#define _MODELSTORAGE_H
+
+#include "Define.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace VMAP
+{
+    /*! Read only memory mapping of a whole vmap file, shared by all models read from it.
+        Pages are backed by the file itself so they are shared with every other process mapping the same file. */
+    class TC_COMMON_API MappedModelFile
+    {
+        public:
+            ~MappedModelFile();
+
+            static std::shared_ptr<MappedModelFile const> Open(std::string const& filename);
+
+            char const* GetData() const { return static_cast<char const*>(_address); }
+            std::size_t GetSize() const { return _size; }
+
+            MappedModelFile(MappedModelFile const&) = delete;
+            MappedModelFile& operator=(MappedModelFile const&) = delete;
+
+        private:
+            struct Mapping;
+
+            explicit MappedModelFile(std::unique_ptr<Mapping> mapping);
+
+            std::unique_ptr<Mapping> _mapping;
+            void const* _address;
+            std::size_t _size;
+    };
+
+    /*! Array of plain geometry data which is either owned (built by the assembler) or
+        points directly into a MappedModelFile kept alive by the owning WorldModel */
+    template<class T>
+    class ModelArray
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        public:
+            ModelArray() : _external(nullptr), _externalSize(0) { }
+
+            T const* data() const { return _external ? _external : _owned.data(); }
+            std::size_t size() const { return _external ? _externalSize : _owned.size(); }
+            bool empty() const { return size() == 0; }
+            T const& operator[](std::size_t index) const { return data()[index]; }
+            T const* begin() const { return data(); }
+            T const* end() const { return data() + size(); }
+
+            void clear() { _owned.clear(); _external = nullptr; _externalSize = 0; }
+
+            //! storage for building the array in memory, drops any mapped view
+            std::vector<T>& Storage()
+            {
+                if (_external)
+                {
+                    _owned.assign(_external, _external + _externalSize);
+                    _external = nullptr;
+                    _externalSize = 0;
+                }
+                return _owned;
+            }
+
+            void SetView(T const* data, std::size_t count)
+            {
+                _owned.clear();
+                _external = data;
+                _externalSize = count;
+            }
+
+        private:
+            std::vector<T> _owned;
+            T const* _external;
+            std::size_t _externalSize;
+    };
+
+    /*! Sequential reader over a MappedModelFile */
+    class ModelFileReader
+    {
+        public:
+            explicit ModelFileReader(MappedModelFile const& file) : _data(file.GetData()), _size(file.GetSize()), _pos(0) { }
+
+            template<class T>
+            bool Read(T& value)
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                if (_size - _pos < sizeof(T))
+                    return false;
+
+                std::memcpy(&value, _data + _pos, sizeof(T));
+                _pos += sizeof(T);
+                return true;
+            }
+
+            template<class T>
+            bool Read(T* values, std::size_t count)
+            {
+                if (count > (_size - _pos) / sizeof(T))
+                    return false;
+
+                std::memcpy(values, _data + _pos, count * sizeof(T));
+                _pos += count * sizeof(T);
+                return true;
+            }
+
+            //! maps count elements without copying them, falls back to a copy for misaligned data
+            template<class T>
+            bool Read(ModelArray<T>& values, std::size_t count)
+            {
+                if (count > (_size - _pos) / sizeof(T))
+                    return false;
+
+                char const* begin = _data + _pos;
+                if (reinterpret_cast<std::uintptr_t>(begin) % alignof(T) == 0)
+                    values.SetView(reinterpret_cast<T const*>(begin), count);
+                else
+                {
+                    values.clear();
+                    std::vector<T>& storage = values.Storage();
+                    storage.resize(count);
+                    std::memcpy(storage.data(), begin, count * sizeof(T));
+                }
+
+                _pos += count * sizeof(T);
+                return true;
+            }
+
+            bool ReadChunk(char const* chunk, std::size_t length)
+            {
+                if (_size - _pos < length || std::memcmp(_data + _pos, chunk, length) != 0)
+                    return false;
+
+                _pos += length;
+                return true;
+            }
+
+            bool Skip(std::size_t length)
+            {
+                if (_size - _pos < length)
+                    return false;
+
+                _pos += length;
+                return true;
+            }
+
+        private:
+            char const* _data;
+            std::size_t _size;
+            std::size_t _pos;
+    };
+}
+
+#endif // _MODELSTORAGE_H
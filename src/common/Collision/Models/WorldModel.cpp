@@ -31,7 +31,7 @@ template<> struct BoundsTrait<VMAP::GroupModel>
 
 namespace VMAP
 {
-    bool IntersectTriangle(MeshTriangle const& tri, std::vector<Vector3>::const_iterator points, G3D::Ray const& ray, float& distance)
+    bool IntersectTriangle(MeshTriangle const& tri, Vector3 const* points, G3D::Ray const& ray, float& distance)
     {
         static const float EPS = 1e-5f;
 
@@ -215,7 +215,7 @@ namespace VMAP
         return 2 * sizeof(uint32) +
                 sizeof(Vector3) +
                 sizeof(uint32) +
-                (iFlags ? ((iTilesX + 1) * (iTilesY + 1) * sizeof(float) + iTilesX * iTilesY) : sizeof(float));
+                (iFlags ? ((iTilesX + 1) * (iTilesY + 1) * sizeof(float) + GetPaddedFlagsSize()) : sizeof(float));
     }
 
     bool WmoLiquid::writeToFile(FILE* wf)
@@ -233,6 +233,12 @@ namespace VMAP
                 {
                     size = iTilesX * iTilesY;
                     result = fwrite(iFlags, sizeof(uint8), size, wf) == size;
+
+                    // keep the geometry of the following group models 4 byte aligned so it can be mapped directly
+                    uint32 const padding = 0;
+                    size = GetPaddedFlagsSize() - size;
+                    if (result && size)
+                        result = fwrite(&padding, 1, size, wf) == size;
                 }
             }
             else
@@ -242,31 +248,31 @@ namespace VMAP
         return result;
     }
 
-    bool WmoLiquid::readFromFile(FILE* rf, WmoLiquid* &out)
+    bool WmoLiquid::readFromFile(ModelFileReader& reader, WmoLiquid* &out)
     {
         bool result = false;
         WmoLiquid* liquid = new WmoLiquid();
 
-        if (fread(&liquid->iTilesX, sizeof(uint32), 1, rf) == 1 &&
-            fread(&liquid->iTilesY, sizeof(uint32), 1, rf) == 1 &&
-            fread(&liquid->iCorner, sizeof(Vector3), 1, rf) == 1 &&
-            fread(&liquid->iType, sizeof(uint32), 1, rf) == 1)
+        if (reader.Read(liquid->iTilesX) &&
+            reader.Read(liquid->iTilesY) &&
+            reader.Read(liquid->iCorner) &&
+            reader.Read(liquid->iType))
         {
             if (liquid->iTilesX && liquid->iTilesY)
             {
                 uint32 size = (liquid->iTilesX + 1) * (liquid->iTilesY + 1);
                 liquid->iHeight = new float[size];
-                if (fread(liquid->iHeight, sizeof(float), size, rf) == size)
+                if (reader.Read(liquid->iHeight, size))
                 {
                     size = liquid->iTilesX * liquid->iTilesY;
                     liquid->iFlags = new uint8[size];
-                    result = fread(liquid->iFlags, sizeof(uint8), size, rf) == size;
+                    result = reader.Read(liquid->iFlags, size) && reader.Skip(liquid->GetPaddedFlagsSize() - size);
                 }
             }
             else
             {
                 liquid->iHeight = new float[1];
-                result = fread(liquid->iHeight, sizeof(float), 1, rf) == 1;
+                result = reader.Read(liquid->iHeight, 1);
             }
         }
 
@@ -297,10 +303,12 @@ namespace VMAP
 
     void GroupModel::setMeshData(std::vector<Vector3> &vert, std::vector<MeshTriangle> &tri)
     {
-        vertices.swap(vert);
-        triangles.swap(tri);
-        TriBoundFunc bFunc(vertices);
-        meshTree.build(triangles, bFunc);
+        vertices.clear();
+        triangles.clear();
+        vertices.Storage().swap(vert);
+        triangles.Storage().swap(tri);
+        TriBoundFunc bFunc(vertices.Storage());
+        meshTree.build(triangles.Storage(), bFunc);
     }
 
     bool GroupModel::writeToFile(FILE* wf)
@@ -320,7 +328,7 @@ namespace VMAP
         if (result && fwrite(&count, sizeof(uint32), 1, wf) != 1) result = false;
         if (!count) // models without (collision) geometry end here, unsure if they are useful
             return result;
-        if (result && fwrite(&vertices[0], sizeof(Vector3), count, wf) != count) result = false;
+        if (result && fwrite(vertices.data(), sizeof(Vector3), count, wf) != count) result = false;
 
         // write triangle mesh
         if (result && fwrite("TRIM", 1, 4, wf) != 4) result = false;
@@ -328,7 +336,7 @@ namespace VMAP
         chunkSize = sizeof(uint32)+ sizeof(MeshTriangle)*count;
         if (result && fwrite(&chunkSize, sizeof(uint32), 1, wf) != 1) result = false;
         if (result && fwrite(&count, sizeof(uint32), 1, wf) != 1) result = false;
-        if (result && fwrite(&triangles[0], sizeof(MeshTriangle), count, wf) != count) result = false;
+        if (result && fwrite(triangles.data(), sizeof(MeshTriangle), count, wf) != count) result = false;
 
         // write mesh BIH
         if (result && fwrite("MBIH", 1, 4, wf) != 4) result = false;
@@ -349,9 +357,8 @@ namespace VMAP
         return result;
     }
 
-    bool GroupModel::readFromFile(FILE* rf)
+    bool GroupModel::readFromFile(ModelFileReader& reader)
     {
-        char chunk[8];
         bool result = true;
         uint32 chunkSize = 0;
         uint32 count = 0;
@@ -360,49 +367,47 @@ namespace VMAP
         delete iLiquid;
         iLiquid = nullptr;
 
-        if (result && fread(&iBound, sizeof(G3D::AABox), 1, rf) != 1) result = false;
-        if (result && fread(&iMogpFlags, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result && fread(&iGroupWMOID, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.Read(iBound)) result = false;
+        if (result && !reader.Read(iMogpFlags)) result = false;
+        if (result && !reader.Read(iGroupWMOID)) result = false;
 
         // read vertices
-        if (result && !readChunk(rf, chunk, "VERT", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result && fread(&count, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.ReadChunk("VERT", 4)) result = false;
+        if (result && !reader.Read(chunkSize)) result = false;
+        if (result && !reader.Read(count)) result = false;
         if (!count) // models without (collision) geometry end here, unsure if they are useful
             return result;
-        if (result) vertices.resize(count);
-        if (result && fread(&vertices[0], sizeof(Vector3), count, rf) != count) result = false;
+        if (result && !reader.Read(vertices, count)) result = false;
 
         // read triangle mesh
-        if (result && !readChunk(rf, chunk, "TRIM", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result && fread(&count, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result) triangles.resize(count);
-        if (result && fread(&triangles[0], sizeof(MeshTriangle), count, rf) != count) result = false;
+        if (result && !reader.ReadChunk("TRIM", 4)) result = false;
+        if (result && !reader.Read(chunkSize)) result = false;
+        if (result && !reader.Read(count)) result = false;
+        if (result && !reader.Read(triangles, count)) result = false;
 
         // read mesh BIH
-        if (result && !readChunk(rf, chunk, "MBIH", 4)) result = false;
-        if (result) result = meshTree.readFromFile(rf);
+        if (result && !reader.ReadChunk("MBIH", 4)) result = false;
+        if (result) result = meshTree.readFromFile(reader);
 
         // write liquid data
-        if (result && !readChunk(rf, chunk, "LIQU", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.ReadChunk("LIQU", 4)) result = false;
+        if (result && !reader.Read(chunkSize)) result = false;
         if (result && chunkSize > 0)
-            result = WmoLiquid::readFromFile(rf, iLiquid);
+            result = WmoLiquid::readFromFile(reader, iLiquid);
         return result;
     }
 
     struct GModelRayCallback
     {
-        GModelRayCallback(std::vector<MeshTriangle> const& tris, const std::vector<Vector3> &vert):
-            vertices(vert.begin()), triangles(tris.begin()), hit(false) { }
+        GModelRayCallback(ModelArray<MeshTriangle> const& tris, ModelArray<Vector3> const& vert):
+            vertices(vert.data()), triangles(tris.data()), hit(false) { }
         bool operator()(G3D::Ray const& ray, uint32 entry, float& distance, bool /*pStopAtFirstHit*/)
         {
             hit = IntersectTriangle(triangles[entry], vertices, ray, distance) || hit;
             return hit;
         }
-        std::vector<Vector3>::const_iterator vertices;
-        std::vector<MeshTriangle>::const_iterator triangles;
+        Vector3 const* vertices;
+        MeshTriangle const* triangles;
         bool hit;
     };
 
@@ -474,8 +479,8 @@ namespace VMAP
 
     void GroupModel::getMeshData(std::vector<G3D::Vector3>& outVertices, std::vector<MeshTriangle>& outTriangles, WmoLiquid*& liquid)
     {
-        outVertices = vertices;
-        outTriangles = triangles;
+        outVertices.assign(vertices.begin(), vertices.end());
+        outTriangles.assign(triangles.begin(), triangles.end());
         liquid = iLiquid;
     }
 
@@ -615,37 +620,35 @@ namespace VMAP
 
     bool WorldModel::readFile(const std::string &filename)
     {
-        FILE* rf = fopen(filename.c_str(), "rb");
-        if (!rf)
+        std::shared_ptr<MappedModelFile const> file = MappedModelFile::Open(filename);
+        if (!file)
             return false;
 
+        ModelFileReader reader(*file);
         bool result = true;
         uint32 chunkSize = 0;
         uint32 count = 0;
-        char chunk[8];                          // Ignore the added magic header
-        if (!readChunk(rf, chunk, VMAP_MAGIC, 8)) result = false;
+        if (!reader.ReadChunk(VMAP_MAGIC, 8)) result = false;
 
-        if (result && !readChunk(rf, chunk, "WMOD", 4)) result = false;
-        if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
-        if (result && fread(&RootWMOID, sizeof(uint32), 1, rf) != 1) result = false;
+        if (result && !reader.ReadChunk("WMOD", 4)) result = false;
+        if (result && !reader.Read(chunkSize)) result = false;
+        if (result && !reader.Read(RootWMOID)) result = false;
 
         // read group models
-        if (result && readChunk(rf, chunk, "GMOD", 4))
+        if (result && reader.ReadChunk("GMOD", 4))
         {
-            //if (fread(&chunkSize, sizeof(uint32), 1, rf) != 1) result = false;
-
-            if (result && fread(&count, sizeof(uint32), 1, rf) != 1) result = false;
+            if (result && !reader.Read(count)) result = false;
             if (result) groupModels.resize(count);
-            //if (result && fread(&groupModels[0], sizeof(GroupModel), count, rf) != count) result = false;
             for (uint32 i=0; i<count && result; ++i)
-                result = groupModels[i].readFromFile(rf);
+                result = groupModels[i].readFromFile(reader);
 
             // read group BIH
-            if (result && !readChunk(rf, chunk, "GBIH", 4)) result = false;
-            if (result) result = groupTree.readFromFile(rf);
+            if (result && !reader.ReadChunk("GBIH", 4)) result = false;
+            if (result) result = groupTree.readFromFile(reader);
         }
 
-        fclose(rf);
+        // group geometry and BIH nodes point into the mapping
+        iMappedFile = std::move(file);
         return result;
     }
 
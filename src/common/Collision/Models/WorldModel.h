@@ -25,6 +25,7 @@
 #include "BoundingIntervalHierarchy.h"
 
 #include "Define.h"
+#include "ModelStorage.h"
 
 namespace VMAP
 {
@@ -58,9 +59,10 @@ namespace VMAP
             uint8 *GetFlagsStorage() { return iFlags; }
             uint32 GetFileSize();
             bool writeToFile(FILE* wf);
-            static bool readFromFile(FILE* rf, WmoLiquid* &liquid);
+            static bool readFromFile(ModelFileReader& reader, WmoLiquid* &liquid);
             void getPosInfo(uint32 &tilesX, uint32 &tilesY, G3D::Vector3 &corner) const;
         private:
+            uint32 GetPaddedFlagsSize() const { return (iTilesX * iTilesY + 3) & ~3u; }
             WmoLiquid() : iTilesX(0), iTilesY(0), iCorner(), iType(0), iHeight(nullptr), iFlags(nullptr) { }
             uint32 iTilesX;       //!< number of tiles in x direction, each
             uint32 iTilesY;
@@ -89,7 +91,7 @@ namespace VMAP
             bool GetLiquidLevel(const G3D::Vector3 &pos, float &liqHeight) const;
             uint32 GetLiquidType() const;
             bool writeToFile(FILE* wf);
-            bool readFromFile(FILE* rf);
+            bool readFromFile(ModelFileReader& reader);
             G3D::AABox const& GetBound() const { return iBound; }
             G3D::AABox const& GetMeshTreeBound() const { return meshTree.bound(); }
             uint32 GetMogpFlags() const { return iMogpFlags; }
@@ -99,8 +101,8 @@ namespace VMAP
             G3D::AABox iBound;
             uint32 iMogpFlags;// 0x8 outdor; 0x2000 indoor
             uint32 iGroupWMOID;
-            std::vector<G3D::Vector3> vertices;
-            std::vector<MeshTriangle> triangles;
+            ModelArray<G3D::Vector3> vertices;
+            ModelArray<MeshTriangle> triangles;
             BIH meshTree;
             WmoLiquid* iLiquid;
     };
@@ -118,12 +120,14 @@ namespace VMAP
             bool GetLocationInfo(const G3D::Vector3 &p, const G3D::Vector3 &down, float &dist, GroupLocationInfo& info) const;
             bool writeFile(const std::string &filename);
             bool readFile(const std::string &filename);
+            //! returned group models may reference geometry owned by this WorldModel and must not outlive it
             void getGroupModels(std::vector<GroupModel>& outGroupModels);
             uint32 Flags;
         protected:
             uint32 RootWMOID;
             std::vector<GroupModel> groupModels;
             BIH groupTree;
+            std::shared_ptr<MappedModelFile const> iMappedFile; //!< backing memory of the geometry loaded by readFile
     };
 } // namespace VMAP
 
@@ -24,7 +24,7 @@
 
 namespace VMAP
 {
-    const char VMAP_MAGIC[] = "VMAP_4.8";
+    const char VMAP_MAGIC[] = "VMAP_4.9";
     const char RAW_VMAP_MAGIC[] = "VMAP048";                // used in extracted vmap files with raw data
     const char GAMEOBJECT_MODELS[] = "GameObjectModels.dtree";
 
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AliasTable.h"
+#include "Errors.h"
+#include "Random.h"
+#include <numeric>
+
+AliasTable::AliasTable(std::vector<double> const& weights) : _probability(weights.size(), 1.0), _alias(weights.size())
+{
+    double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+    ASSERT(total > 0.0, "AliasTable needs at least one positive weight");
+
+    // scale weights so that the average column holds exactly 1
+    std::vector<double> scaled(weights.size());
+    std::vector<uint32> small, large;
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        scaled[i] = weights[i] * weights.size() / total;
+        _alias[i] = uint32(i);
+        if (scaled[i] < 1.0)
+            small.push_back(uint32(i));
+        else
+            large.push_back(uint32(i));
+    }
+
+    // fill every underfull column with the excess of an overfull one
+    while (!small.empty() && !large.empty())
+    {
+        uint32 less = small.back();
+        small.pop_back();
+        uint32 more = large.back();
+
+        _probability[less] = scaled[less];
+        _alias[less] = more;
+
+        scaled[more] -= 1.0 - scaled[less];
+        if (scaled[more] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // whatever is left is full up to rounding errors
+    for (uint32 i : small)
+        _probability[i] = 1.0;
+    for (uint32 i : large)
+        _probability[i] = 1.0;
+}
+
+std::size_t AliasTable::Select() const
+{
+    return Select(urand(0, uint32(size() - 1)), rand_norm());
+}
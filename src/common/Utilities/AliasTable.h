@@ -0,0 +1,54 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_ALIAS_TABLE_H
+#define TRINITYCORE_ALIAS_TABLE_H
+
+#include "Define.h"
+#include <vector>
+
+/*
+ * Weighted random selection in constant time (Vose's alias method).
+ * Building the table is linear in the number of weights, so it is meant for
+ * distributions that are known at load time and sampled often, like loot groups.
+ */
+class TC_COMMON_API AliasTable
+{
+public:
+    AliasTable() = default;
+
+    //! weights must not be negative and at least one must be positive
+    explicit AliasTable(std::vector<double> const& weights);
+
+    bool empty() const { return _probability.empty(); }
+    std::size_t size() const { return _probability.size(); }
+
+    //! Returns index i with probability weights[i] / sum(weights)
+    std::size_t Select() const;
+
+    //! Same as Select with the random numbers supplied by the caller, column in [0, size()) and coin in [0, 1)
+    std::size_t Select(std::size_t column, double coin) const
+    {
+        return coin < _probability[column] ? column : _alias[column];
+    }
+
+private:
+    std::vector<double> _probability;
+    std::vector<uint32> _alias;
+};
+
+#endif // TRINITYCORE_ALIAS_TABLE_H
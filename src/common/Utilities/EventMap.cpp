@@ -17,6 +17,7 @@
 
 #include "EventMap.h"
 #include "Random.h"
+#include <algorithm>
 
 void EventMap::Reset()
 {
@@ -41,7 +42,7 @@ void EventMap::ScheduleEvent(EventId eventId, Milliseconds time, GroupIndex grou
     if (phase > sizeof(PhaseMask) * 8)
         return;
 
-    _eventMap.insert(EventStore::value_type(_time + time, Event(eventId, group, phase)));
+    Insert(_time + time, Event(eventId, group, phase));
 }
 
 void EventMap::ScheduleEvent(EventId eventId, Milliseconds minTime, Milliseconds maxTime, GroupIndex group /*= 0*/, PhaseIndex phase /*= 0*/)
@@ -62,7 +63,7 @@ void EventMap::RescheduleEvent(EventId eventId, Milliseconds minTime, Millisecon
 
 void EventMap::Repeat(Milliseconds time)
 {
-    _eventMap.insert(EventStore::value_type(_time + time, _lastEvent));
+    Insert(_time + time, _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
@@ -74,17 +75,17 @@ EventMap::EventId EventMap::ExecuteEvent()
 {
     while (!Empty())
     {
-        auto itr = _eventMap.begin();
+        auto& [time, event] = _eventMap.back();
 
-        if (itr->first > _time)
+        if (time > _time)
             return 0;
-        else if (_phaseMask && itr->second._phaseMask && !(itr->second._phaseMask & _phaseMask))
-            _eventMap.erase(itr);
+        else if (_phaseMask && event._phaseMask && !(event._phaseMask & _phaseMask))
+            _eventMap.pop_back();
         else
         {
-            auto eventId = itr->second._id;
-            _lastEvent = itr->second;
-            _eventMap.erase(itr);
+            auto eventId = event._id;
+            _lastEvent = event;
+            _eventMap.pop_back();
             return eventId;
         }
     }
@@ -94,16 +95,8 @@ EventMap::EventId EventMap::ExecuteEvent()
 
 void EventMap::DelayEvents(Milliseconds delay)
 {
-    if (Empty())
-        return;
-
-    EventStore delayed = std::move(_eventMap);
-    for (auto itr = delayed.begin(); itr != delayed.end();)
-    {
-        EventStore::node_type node = delayed.extract(itr++);
-        node.key() = node.key() + delay;
-        _eventMap.insert(_eventMap.end(), std::move(node));
-    }
+    for (auto& [time, event] : _eventMap)
+        time += delay;
 }
 
 void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
@@ -111,20 +104,21 @@ void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
     if (!group || group > sizeof(GroupMask) * 8 || Empty())
         return;
 
+    GroupMask groupMask = GroupMask(1u << (group - 1u));
+
+    // walk in execution order so delayed events keep their relative order
     EventStore delayed;
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (itr->second._groupMask & groupMask)
+            delayed.emplace_back(itr->first + delay, itr->second);
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (itr->second._groupMask & GroupMask(1u << (group - 1u)))
-        {
-            delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
-            _eventMap.erase(itr++);
-        }
-        else
-            ++itr;
-    }
+    if (delayed.empty())
+        return;
+
+    std::erase_if(_eventMap, [groupMask](EventStore::value_type const& entry) { return (entry.second._groupMask & groupMask) != 0; });
 
-    _eventMap.insert(delayed.begin(), delayed.end());
+    for (auto const& [time, event] : delayed)
+        Insert(time, event);
 }
 
 void EventMap::SetMinimalDelay(EventId eventId, Milliseconds delay)
@@ -132,34 +126,25 @@ void EventMap::SetMinimalDelay(EventId eventId, Milliseconds delay)
     if (Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (eventId == itr->second._id)
-        {
-            if (itr->first < (_time + delay))
-            {
-                _eventMap.insert(EventStore::value_type(_time + delay, itr->second));
-                itr = _eventMap.erase(itr);
-                continue;
-            }
+    TimePoint minTime = _time + delay;
 
-        }
-        ++itr;
-    }
+    EventStore delayed;
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (eventId == itr->second._id && itr->first < minTime)
+            delayed.emplace_back(minTime, itr->second);
+
+    if (delayed.empty())
+        return;
+
+    std::erase_if(_eventMap, [eventId, minTime](EventStore::value_type const& entry) { return eventId == entry.second._id && entry.first < minTime; });
+
+    for (auto const& [time, event] : delayed)
+        Insert(time, event);
 }
 
 void EventMap::CancelEvent(EventId eventId)
 {
-    if (Empty())
-        return;
-
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (eventId == itr->second._id)
-            _eventMap.erase(itr++);
-        else
-            ++itr;
-    }
+    std::erase_if(_eventMap, [eventId](EventStore::value_type const& entry) { return eventId == entry.second._id; });
 }
 
 void EventMap::CancelEventGroup(GroupIndex group)
@@ -167,20 +152,15 @@ void EventMap::CancelEventGroup(GroupIndex group)
     if (!group || group > sizeof(GroupMask) * 8 || Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (itr->second._groupMask & GroupMask(1u << (group - 1u)))
-            _eventMap.erase(itr++);
-        else
-            ++itr;
-    }
+    GroupMask groupMask = GroupMask(1u << (group - 1u));
+    std::erase_if(_eventMap, [groupMask](EventStore::value_type const& entry) { return (entry.second._groupMask & groupMask) != 0; });
 }
 
 Milliseconds EventMap::GetTimeUntilEvent(EventId eventId) const
 {
-    for (auto const& [time, event] : _eventMap)
-        if (eventId == event._id)
-            return std::chrono::duration_cast<Milliseconds>(time - _time);
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (eventId == itr->second._id)
+            return std::chrono::duration_cast<Milliseconds>(itr->first - _time);
 
     return Milliseconds::max();
 }
@@ -189,3 +169,10 @@ bool EventMap::HasEventScheduled(EventId eventId) const
 {
     return GetTimeUntilEvent(eventId) != Milliseconds::max();
 }
+
+void EventMap::Insert(TimePoint time, Event const& event)
+{
+    // first entry that executes at or before the new one, inserting in front of it puts the new event after all equal ones in execution order
+    auto itr = std::lower_bound(_eventMap.begin(), _eventMap.end(), time, [](EventStore::value_type const& entry, TimePoint time) { return entry.first > time; });
+    _eventMap.emplace(itr, time, event);
+}
@@ -20,7 +20,8 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include <utility>
+#include <vector>
 
 class TC_COMMON_API EventMap
 {
@@ -46,9 +47,12 @@ class TC_COMMON_API EventMap
 
     /**
      * Internal storage type.
-     * Key: Time as TimePoint when the event should occur.
+     * First: Time as TimePoint when the event should occur.
+     * Kept sorted by descending time, so the next event is always at the back
+     * and executing it never moves the other entries.
+     * Events with equal time execute in the order they were scheduled.
      */
-    using EventStore = std::multimap<TimePoint, Event>;
+    using EventStore = std::vector<std::pair<TimePoint, Event>>;
 
 public:
     EventMap() : _time(TimePoint::min()), _phaseMask(0) { }
@@ -256,6 +260,12 @@ public:
     bool HasEventScheduled(EventId eventId) const;
 
 private:
+    /**
+    * @name Insert
+    * @brief Inserts an event behind all scheduled events with the same time.
+    */
+    void Insert(TimePoint time, Event const& event);
+
     /**
     * @name _time
     * @brief Internal timer.
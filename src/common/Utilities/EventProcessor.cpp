@@ -17,6 +17,7 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include <algorithm>
 
 void BasicEvent::ScheduleAbort()
 {
@@ -43,12 +44,12 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    std::multimap<uint64, BasicEvent*>::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.front().ExecTime <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        std::pop_heap(m_events.begin(), m_events.end());
+        BasicEvent* event = m_events.back().Event;
+        m_events.pop_back();
 
         if (event->IsRunning())
         {
@@ -81,33 +82,39 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    // Aborting or deleting an event may add new ones, detach the current ones first
+    std::vector<ScheduledEvent> events;
+    events.swap(m_events);
+
+    std::vector<ScheduledEvent> kept;
+    for (ScheduledEvent const& scheduled : events)
     {
+        BasicEvent* event = scheduled.Event;
+
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
+        if (!force && !event->IsDeletable())
         {
-            ++itr;
+            kept.push_back(scheduled);
             continue;
         }
 
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        delete event;
     }
 
     if (force)
-        m_events.clear();
+        return;
+
+    // kept entries are a subset of a valid heap ordering, re-heapify together with anything added meanwhile
+    m_events.insert(m_events.end(), kept.begin(), kept.end());
+    std::make_heap(m_events.begin(), m_events.end());
 }
 
 void EventProcessor::AddEvent(BasicEvent* event, Milliseconds e_time, bool set_addtime)
@@ -115,19 +122,19 @@ void EventProcessor::AddEvent(BasicEvent* event, Milliseconds e_time, bool set_a
     if (set_addtime)
         event->m_addTime = m_time;
     event->m_execTime = e_time.count();
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time.count(), event));
+    m_events.push_back({ uint64(e_time.count()), m_nextSequence++, event });
+    std::push_heap(m_events.begin(), m_events.end());
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
-
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    auto itr = std::find_if(m_events.begin(), m_events.end(), [event](ScheduledEvent const& scheduled) { return scheduled.Event == event; });
+    if (itr == m_events.end())
+        return;
+
+    // moved to the back of the events sharing its new time, same as a fresh AddEvent
+    event->m_execTime = newTime.count();
+    itr->ExecTime = newTime.count();
+    itr->Sequence = m_nextSequence++;
+    std::make_heap(m_events.begin(), m_events.end());
 }
@@ -21,8 +21,8 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
-#include <map>
 #include <type_traits>
+#include <vector>
 
 class EventProcessor;
 
@@ -92,8 +92,22 @@ using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::rem
 
 class TC_COMMON_API EventProcessor
 {
+        // min-heap entry, events with equal execution time run in the order they were added
+        struct ScheduledEvent
+        {
+            uint64 ExecTime;
+            uint64 Sequence;
+            BasicEvent* Event;
+
+            bool operator<(ScheduledEvent const& right) const
+            {
+                // std heap functions build a max-heap, invert the ordering
+                return ExecTime != right.ExecTime ? ExecTime > right.ExecTime : Sequence > right.Sequence;
+            }
+        };
+
     public:
-        EventProcessor() : m_time(0) { }
+        EventProcessor() : m_time(0), m_nextSequence(0) { }
         ~EventProcessor();
 
         void Update(uint32 p_time);
@@ -113,7 +127,8 @@ class TC_COMMON_API EventProcessor
 
     protected:
         uint64 m_time;
-        std::multimap<uint64, BasicEvent*> m_events;
+        uint64 m_nextSequence;
+        std::vector<ScheduledEvent> m_events;
 };
 
 #endif
@@ -0,0 +1,130 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_INTRUSIVE_HEAP_H
+#define TRINITYCORE_INTRUSIVE_HEAP_H
+
+#include "Define.h"
+#include <utility>
+#include <vector>
+
+/*
+ * Binary heap of pointers stored in a single array. Every node keeps its own position in the
+ * member HeapIndex, so nodes can be removed or moved after a key change in O(log n).
+ * Ordering follows std::priority_queue, top() is an element no other element compares greater than.
+ * The heap doesn't own its nodes.
+ */
+template<typename T, typename Compare, std::size_t T::*HeapIndex>
+class IntrusiveHeap
+{
+public:
+    typedef typename std::vector<T*>::const_iterator const_iterator;
+
+    bool empty() const { return _nodes.empty(); }
+    std::size_t size() const { return _nodes.size(); }
+
+    T* top() const { return _nodes.front(); }
+
+    void push(T* node)
+    {
+        _nodes.push_back(node);
+        Place(_nodes.size() - 1, node);
+        SiftUp(_nodes.size() - 1);
+    }
+
+    void pop()
+    {
+        erase(_nodes.front());
+    }
+
+    void erase(T* node)
+    {
+        std::size_t index = node->*HeapIndex;
+        T* last = _nodes.back();
+        _nodes.pop_back();
+        if (last == node)
+            return;
+
+        Place(index, last);
+        update(last);
+    }
+
+    //! Restores the heap order after the key of node changed, in either direction
+    void update(T* node)
+    {
+        std::size_t index = node->*HeapIndex;
+        if (!SiftUp(index))
+            SiftDown(index);
+    }
+
+    void clear() { _nodes.clear(); }
+
+    const_iterator begin() const { return _nodes.begin(); }
+    const_iterator end() const { return _nodes.end(); }
+
+private:
+    void Place(std::size_t index, T* node)
+    {
+        _nodes[index] = node;
+        node->*HeapIndex = index;
+    }
+
+    bool SiftUp(std::size_t index)
+    {
+        T* node = _nodes[index];
+        std::size_t start = index;
+        while (index > 0)
+        {
+            std::size_t parent = (index - 1) / 2;
+            if (!_compare(_nodes[parent], node))
+                break;
+
+            Place(index, _nodes[parent]);
+            index = parent;
+        }
+
+        Place(index, node);
+        return index != start;
+    }
+
+    void SiftDown(std::size_t index)
+    {
+        T* node = _nodes[index];
+        while (true)
+        {
+            std::size_t child = index * 2 + 1;
+            if (child >= _nodes.size())
+                break;
+
+            if (child + 1 < _nodes.size() && _compare(_nodes[child], _nodes[child + 1]))
+                ++child;
+
+            if (!_compare(node, _nodes[child]))
+                break;
+
+            Place(index, _nodes[child]);
+            index = child;
+        }
+
+        Place(index, node);
+    }
+
+    std::vector<T*> _nodes;
+    Compare _compare;
+};
+
+#endif // TRINITYCORE_INTRUSIVE_HEAP_H
@@ -0,0 +1,164 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include <algorithm>
+
+namespace
+{
+    struct ObjectPoolRegistry
+    {
+        std::mutex Lock;
+        std::vector<ObjectPoolBase const*> Pools;
+    };
+
+    ObjectPoolRegistry& GetRegistry()
+    {
+        static ObjectPoolRegistry registry;
+        return registry;
+    }
+
+    // free blocks store the next free block in their first bytes
+    void*& NextFree(void* block)
+    {
+        return *static_cast<void**>(block);
+    }
+
+    constexpr std::size_t ChunkSize = 64 * 1024;
+    constexpr std::size_t MinBlocksPerChunk = 16;
+}
+
+ObjectPoolBase::ObjectPoolBase(char const* name, std::size_t blockSize, std::size_t alignment) : _name(name),
+    _alignment(std::max(alignment, alignof(void*))), _freeHead(nullptr), _allocations(0), _deallocations(0), _chunkCount(0)
+{
+    _blockSize = std::max(blockSize, sizeof(void*));
+    _blockSize = (_blockSize + _alignment - 1) / _alignment * _alignment;
+    _blocksPerChunk = std::max(ChunkSize / _blockSize, MinBlocksPerChunk);
+
+    ObjectPoolRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Lock);
+    registry.Pools.push_back(this);
+}
+
+ObjectPoolBase::~ObjectPoolBase()
+{
+    {
+        ObjectPoolRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Lock);
+        registry.Pools.erase(std::remove(registry.Pools.begin(), registry.Pools.end(), this), registry.Pools.end());
+    }
+
+    for (void* chunk : _chunks)
+        ::operator delete(chunk, std::align_val_t(_alignment));
+}
+
+void* ObjectPoolBase::Allocate(ThreadCache& cache)
+{
+    if (!cache.Head)
+    {
+        // refill the thread cache with a batch from the shared list
+        std::lock_guard<std::mutex> lock(_lock);
+        for (uint32 i = 0; i < TransferBatchSize; ++i)
+        {
+            if (!_freeHead)
+                AllocateChunk();
+
+            void* block = _freeHead;
+            _freeHead = NextFree(block);
+            NextFree(block) = cache.Head;
+            cache.Head = block;
+            ++cache.Count;
+        }
+    }
+
+    void* block = cache.Head;
+    cache.Head = NextFree(block);
+    --cache.Count;
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+    return block;
+}
+
+void ObjectPoolBase::Deallocate(ThreadCache& cache, void* block)
+{
+    NextFree(block) = cache.Head;
+    cache.Head = block;
+    ++cache.Count;
+    _deallocations.fetch_add(1, std::memory_order_relaxed);
+
+    // threads that free more than they allocate, like the one a player teleported to, give blocks back
+    if (cache.Count < TransferBatchSize * 4)
+        return;
+
+    void* batchHead = cache.Head;
+    void* batchTail = batchHead;
+    for (uint32 i = 1; i < TransferBatchSize; ++i)
+        batchTail = NextFree(batchTail);
+
+    cache.Head = NextFree(batchTail);
+    cache.Count -= TransferBatchSize;
+
+    std::lock_guard<std::mutex> lock(_lock);
+    NextFree(batchTail) = _freeHead;
+    _freeHead = batchHead;
+}
+
+void ObjectPoolBase::Flush(ThreadCache& cache)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    while (cache.Head)
+    {
+        void* block = cache.Head;
+        cache.Head = NextFree(block);
+        NextFree(block) = _freeHead;
+        _freeHead = block;
+    }
+    cache.Count = 0;
+}
+
+void ObjectPoolBase::AllocateChunk()
+{
+    char* chunk = static_cast<char*>(::operator new(_blockSize * _blocksPerChunk, std::align_val_t(_alignment)));
+    _chunks.push_back(chunk);
+    _chunkCount.fetch_add(1, std::memory_order_relaxed);
+
+    for (std::size_t i = _blocksPerChunk; i > 0; --i)
+    {
+        void* block = chunk + (i - 1) * _blockSize;
+        NextFree(block) = _freeHead;
+        _freeHead = block;
+    }
+}
+
+ObjectPoolStatistics ObjectPoolBase::GetStatistics() const
+{
+    ObjectPoolStatistics statistics;
+    statistics.Name = _name;
+    statistics.BlockSize = _blockSize;
+    statistics.Allocations = _allocations.load(std::memory_order_relaxed);
+    statistics.Deallocations = _deallocations.load(std::memory_order_relaxed);
+    statistics.Chunks = _chunkCount.load(std::memory_order_relaxed);
+    statistics.ReservedBytes = statistics.Chunks * _blockSize * _blocksPerChunk;
+    return statistics;
+}
+
+void ObjectPoolBase::VisitPools(std::function<void(ObjectPoolStatistics const&)> const& visitor)
+{
+    ObjectPoolRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Lock);
+    for (ObjectPoolBase const* pool : registry.Pools)
+        visitor(pool->GetStatistics());
+}
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_OBJECT_POOL_H
+#define TRINITYCORE_OBJECT_POOL_H
+
+#include "Define.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(__SANITIZE_ADDRESS__)
+#define TRINITY_OBJECT_POOL_PASSTHROUGH
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(memory_sanitizer)
+#define TRINITY_OBJECT_POOL_PASSTHROUGH
+#endif
+#endif
+
+struct ObjectPoolStatistics
+{
+    char const* Name;
+    std::size_t BlockSize;
+    uint64 Allocations;
+    uint64 Deallocations;
+    uint64 Chunks;
+    std::size_t ReservedBytes;
+};
+
+/*
+ * Fixed size block allocator for objects that are created and destroyed at a high rate.
+ *
+ * Every thread keeps a small cache of free blocks, so map threads allocate without locking.
+ * Blocks can be freed on any thread, caches that grow too large hand batches back to the shared list.
+ * Memory is only returned to the system when the pool is destroyed.
+ * Sanitizer builds bypass the pool to keep use after free detection working.
+ */
+class TC_COMMON_API ObjectPoolBase
+{
+public:
+    struct ThreadCache
+    {
+        explicit ThreadCache(ObjectPoolBase& pool) : Pool(pool), Head(nullptr), Count(0) { }
+        ~ThreadCache() { Pool.Flush(*this); }
+
+        ObjectPoolBase& Pool;
+        void* Head;
+        uint32 Count;
+    };
+
+    ObjectPoolBase(char const* name, std::size_t blockSize, std::size_t alignment);
+    ~ObjectPoolBase();
+
+    ObjectPoolBase(ObjectPoolBase const&) = delete;
+    ObjectPoolBase& operator=(ObjectPoolBase const&) = delete;
+
+    void* Allocate(ThreadCache& cache);
+    void Deallocate(ThreadCache& cache, void* block);
+
+    ObjectPoolStatistics GetStatistics() const;
+
+    static void VisitPools(std::function<void(ObjectPoolStatistics const&)> const& visitor);
+
+    static constexpr uint32 TransferBatchSize = 32;
+
+private:
+    void Flush(ThreadCache& cache);
+    void AllocateChunk();
+
+    char const* _name;
+    std::size_t _blockSize;
+    std::size_t _alignment;
+    std::size_t _blocksPerChunk;
+
+    std::mutex _lock;
+    void* _freeHead;
+    std::vector<void*> _chunks;
+
+    std::atomic<uint64> _allocations;
+    std::atomic<uint64> _deallocations;
+    std::atomic<uint64> _chunkCount;
+};
+
+template<class T>
+class ObjectPool
+{
+public:
+    static void* Allocate(std::size_t size, char const* name)
+    {
+#ifndef TRINITY_OBJECT_POOL_PASSTHROUGH
+        // derived classes that don't declare their own pool end up here too
+        if (size == sizeof(T))
+            return Instance(name).Allocate(Cache(name));
+#else
+        (void)name;
+#endif
+        return ::operator new(size);
+    }
+
+    static void Deallocate(void* ptr, std::size_t size, char const* name)
+    {
+#ifndef TRINITY_OBJECT_POOL_PASSTHROUGH
+        if (size == sizeof(T))
+        {
+            Instance(name).Deallocate(Cache(name), ptr);
+            return;
+        }
+#else
+        (void)name;
+#endif
+        ::operator delete(ptr);
+    }
+
+private:
+    static ObjectPoolBase& Instance(char const* name)
+    {
+        static ObjectPoolBase pool(name, sizeof(T), alignof(T));
+        return pool;
+    }
+
+    static ObjectPoolBase::ThreadCache& Cache(char const* name)
+    {
+        thread_local ObjectPoolBase::ThreadCache cache(Instance(name));
+        return cache;
+    }
+};
+
+//! Declares class specific operator new and delete, allocations of exactly this class are served by ObjectPool
+#define TC_DECLARE_POOLED_ALLOCATION() \
+    static void* operator new(std::size_t size); \
+    static void operator delete(void* ptr, std::size_t size)
+
+#define TC_DEFINE_POOLED_ALLOCATION(Type) \
+    void* Type::operator new(std::size_t size) { return ObjectPool<Type>::Allocate(size, #Type); } \
+    void Type::operator delete(void* ptr, std::size_t size) { ObjectPool<Type>::Deallocate(ptr, size, #Type); }
+
+#endif // TRINITYCORE_OBJECT_POOL_H
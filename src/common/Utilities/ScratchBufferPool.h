@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_SCRATCH_BUFFER_POOL_H
+#define TRINITYCORE_SCRATCH_BUFFER_POOL_H
+
+#include "Define.h"
+#include <utility>
+#include <vector>
+
+/*
+ * Pool of vectors for temporary results, handed out as move only leases.
+ * A returned vector is cleared but keeps its capacity, so steady state use doesn't allocate.
+ * Leases may nest, every Acquire gets its own vector.
+ *
+ * Not thread safe, a pool belongs to a single owner like a map.
+ */
+template<class T>
+class ScratchBufferPool
+{
+public:
+    class Lease
+    {
+    public:
+        Lease(Lease&& other) noexcept : _pool(std::exchange(other._pool, nullptr)), _buffer(std::move(other._buffer)) { }
+        Lease& operator=(Lease&&) = delete;
+        Lease(Lease const&) = delete;
+        Lease& operator=(Lease const&) = delete;
+        ~Lease()
+        {
+            if (_pool)
+                _pool->Release(std::move(_buffer));
+        }
+
+        std::vector<T>& operator*() { return _buffer; }
+        std::vector<T>* operator->() { return &_buffer; }
+
+    private:
+        friend class ScratchBufferPool;
+
+        Lease(ScratchBufferPool* pool, std::vector<T>&& buffer) : _pool(pool), _buffer(std::move(buffer)) { }
+
+        ScratchBufferPool* _pool;
+        std::vector<T> _buffer;
+    };
+
+    //! buffers that grew beyond maxRetainedCapacity elements are freed instead of being kept
+    explicit ScratchBufferPool(std::size_t maxRetainedCapacity = 4096) : _maxRetainedCapacity(maxRetainedCapacity) { }
+
+    ScratchBufferPool(ScratchBufferPool const&) = delete;
+    ScratchBufferPool& operator=(ScratchBufferPool const&) = delete;
+
+    Lease Acquire()
+    {
+        if (_free.empty())
+            return Lease(this, std::vector<T>());
+
+        std::vector<T> buffer = std::move(_free.back());
+        _free.pop_back();
+        return Lease(this, std::move(buffer));
+    }
+
+    std::size_t GetFreeCount() const { return _free.size(); }
+
+private:
+    void Release(std::vector<T>&& buffer)
+    {
+        if (buffer.capacity() > _maxRetainedCapacity)
+            return;
+
+        buffer.clear();
+        _free.push_back(std::move(buffer));
+    }
+
+    std::vector<std::vector<T>> _free;
+    std::size_t _maxRetainedCapacity;
+};
+
+#endif // TRINITYCORE_SCRATCH_BUFFER_POOL_H
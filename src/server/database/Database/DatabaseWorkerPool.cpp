@@ -33,6 +33,7 @@
 #include "Transaction.h"
 #include "MySQLWorkaround.h"
 #include <mysqld_error.h>
+#include <algorithm>
 #ifdef TRINITY_DEBUG
 #include <sstream>
 #include <boost/stacktrace.hpp>
@@ -238,12 +239,18 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 }
 
 template <class T>
-SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, uint32 maxParallelism /*= 1*/)
 {
-    SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
+    size_t taskCount = std::min<size_t>({ maxParallelism, _async_threads, holder->GetSize() });
+    if (!taskCount)
+        taskCount = 1;
+
+    std::shared_ptr<SQLQueryHolderProgress> progress = std::make_shared<SQLQueryHolderProgress>(taskCount);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
-    QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    QueryResultHolderFuture result = progress->Result.get_future();
+    for (size_t i = 0; i < taskCount; ++i)
+        Enqueue(new SQLQueryHolderTask(holder, progress, i, taskCount));
+
     return { std::move(holder), std::move(result) };
 }
 
@@ -199,7 +199,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_INS_EQUIP_SET,
     CHAR_DEL_EQUIP_SET,
 
-    CHAR_INS_AURA,
+    CHAR_REP_AURA,
 
     CHAR_SEL_ACCOUNT_DATA,
     CHAR_REP_ACCOUNT_DATA,
@@ -413,6 +413,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_CHARACTER,
     CHAR_DEL_CHAR_ACTION,
     CHAR_DEL_CHAR_AURA,
+    CHAR_DEL_CHAR_AURA_BY_KEY,
     CHAR_DEL_CHAR_GIFT,
     CHAR_DEL_CHAR_INSTANCE,
     CHAR_DEL_CHAR_INVENTORY,
@@ -449,7 +450,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_UPD_CHAR_SKILLS,
     CHAR_INS_CHAR_SPELL,
     CHAR_DEL_CHAR_STATS,
-    CHAR_INS_CHAR_STATS,
+    CHAR_REP_CHAR_STATS,
     CHAR_DEL_PETITION_BY_OWNER,
     CHAR_DEL_PETITION_SIGNATURE_BY_OWNER,
     CHAR_DEL_PETITION_BY_OWNER_AND_TYPE,
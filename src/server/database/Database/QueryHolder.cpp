@@ -76,12 +76,14 @@ SQLQueryHolderTask::~SQLQueryHolderTask() = default;
 
 bool SQLQueryHolderTask::Execute()
 {
-    /// execute all queries in the holder and pass the results
-    for (size_t i = 0; i < m_holder->m_queries.size(); ++i)
+    /// execute this task's share of the queries in the holder and pass the results
+    /// tasks of the same holder write to different elements, so they don't need to synchronize
+    for (size_t i = m_firstQuery; i < m_holder->m_queries.size(); i += m_queryStride)
         if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
             m_holder->SetPreparedResult(i, m_conn->Query(stmt));
 
-    m_result.set_value();
+    if (m_progress->PendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        m_progress->Result.set_value();
     return true;
 }
 
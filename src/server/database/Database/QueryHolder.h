@@ -19,6 +19,7 @@
 #define _QUERYHOLDER_H
 
 #include "SQLOperation.h"
+#include <atomic>
 #include <vector>
 
 class TC_DATABASE_API SQLQueryHolderBase
@@ -30,6 +31,7 @@ class TC_DATABASE_API SQLQueryHolderBase
         SQLQueryHolderBase() = default;
         virtual ~SQLQueryHolderBase();
         void SetSize(size_t size);
+        size_t GetSize() const { return m_queries.size(); }
         PreparedQueryResult GetPreparedResult(size_t index) const;
         void SetPreparedResult(size_t index, PreparedResultSet* result);
 
@@ -47,20 +49,35 @@ public:
     }
 };
 
+//! Shared by all tasks executing parts of the same holder, the last one to finish fulfills the promise
+struct SQLQueryHolderProgress
+{
+    explicit SQLQueryHolderProgress(size_t pendingTasks) : PendingTasks(pendingTasks) { }
+
+    std::atomic<size_t> PendingTasks;
+    QueryResultHolderPromise Result;
+};
+
 class TC_DATABASE_API SQLQueryHolderTask : public SQLOperation
 {
     private:
         std::shared_ptr<SQLQueryHolderBase> m_holder;
-        QueryResultHolderPromise m_result;
+        std::shared_ptr<SQLQueryHolderProgress> m_progress;
+        size_t m_firstQuery;
+        size_t m_queryStride;
 
     public:
         explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder)
-            : m_holder(std::move(holder)) { }
+            : SQLQueryHolderTask(std::move(holder), std::make_shared<SQLQueryHolderProgress>(1), 0, 1) { }
+
+        //! Executes queries firstQuery, firstQuery + queryStride, ... of the holder
+        SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder, std::shared_ptr<SQLQueryHolderProgress> progress, size_t firstQuery, size_t queryStride)
+            : m_holder(std::move(holder)), m_progress(std::move(progress)), m_firstQuery(firstQuery), m_queryStride(queryStride) { }
 
         ~SQLQueryHolderTask();
 
         bool Execute() override;
-        QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
+        QueryResultHolderFuture GetFuture() { return m_progress->Result.get_future(); }
 };
 
 class TC_DATABASE_API SQLQueryHolderCallback
@@ -22,6 +22,7 @@
 #include "Creature.h"
 #include "CreatureTextMgr.h"
 #include "CreatureTextMgrImpl.h"
+#include "CreatureUpdateProfiler.h"
 #include "GameEventMgr.h"
 #include "GameObject.h"
 #include "GossipDef.h"
@@ -42,6 +43,51 @@
 #include "Vehicle.h"
 #include "WaypointDefines.h"
 #include <G3D/Quat.h>
+#include <bit>
+#include <numeric>
+
+namespace
+{
+    // events UpdateTimer processes itself once their timer expires
+    bool IsPolledEvent(uint32 eventType)
+    {
+        switch (eventType)
+        {
+            case SMART_EVENT_UPDATE:
+            case SMART_EVENT_UPDATE_OOC:
+            case SMART_EVENT_UPDATE_IC:
+            case SMART_EVENT_HEALTH_PCT:
+            case SMART_EVENT_MANA_PCT:
+            case SMART_EVENT_RANGE:
+            case SMART_EVENT_VICTIM_CASTING:
+            case SMART_EVENT_FRIENDLY_IS_CC:
+            case SMART_EVENT_FRIENDLY_MISSING_BUFF:
+            case SMART_EVENT_HAS_AURA:
+            case SMART_EVENT_TARGET_BUFFED:
+            case SMART_EVENT_FRIENDLY_HEALTH_PCT:
+            case SMART_EVENT_DISTANCE_CREATURE:
+            case SMART_EVENT_DISTANCE_GAMEOBJECT:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // true when UpdateTimer can't change the event: it isn't polled, no cooldown is running and it can't be delayed
+    bool IsTimerIdle(SmartScriptHolder const& e)
+    {
+        if (e.GetEventType() == SMART_EVENT_LINK)
+            return true;
+
+        if (IsPolledEvent(e.GetEventType()))
+            return false;
+
+        if (e.GetActionType() == SMART_ACTION_CAST || e.GetActionType() == SMART_ACTION_FLEE_FOR_ASSIST)
+            return false;
+
+        return e.active && !e.timer;
+    }
+}
 
 SmartScript::SmartScript()
 {
@@ -50,6 +96,8 @@ SmartScript::SmartScript()
     trigger = nullptr;
     atPlayer = nullptr;
     mEventPhase = 0;
+    mEventPhaseMask = 0;
+    mEventTypeOffsets.fill(0);
     mPathId = 0;
     mTextTimer = 0;
     mLastTextID = 0;
@@ -193,6 +241,9 @@ void SmartScript::OnReset()
             mEventSortingRequired = true;
         }
     }
+    for (SmartScriptHolder const& event : mEvents)
+        UpdateEventTimerState(event);
+
     ProcessEventsFor(SMART_EVENT_RESET);
     mLastInvoker.Clear();
 }
@@ -236,17 +287,22 @@ void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint3
     {
         TC_LOG_WARN("scripts.ai", "SmartScript::ProcessEventsFor: reached the limit of max allowed nested ProcessEventsFor() calls with event {}, skipping!\n{}", e, GetBaseObject()->GetDebugInfo());
     }
-    else
+    else if (e != SMART_EVENT_LINK && e < SMART_EVENT_END) //special handling
     {
-        for (SmartScriptHolder& event : mEvents)
+        for (uint32 i = mEventTypeOffsets[e]; i < mEventTypeOffsets[e + 1]; ++i)
         {
-            SMART_EVENT eventType = SMART_EVENT(event.GetEventType());
-            if (eventType == SMART_EVENT_LINK)//special handling
+            SmartScriptHolder& event = mEvents[mEventsByType[i]];
+
+            // skip events ProcessEvent would reject anyway before looking up their conditions
+            if (!event.active || (event.event.event_phase_mask && !IsInPhase(event.event.event_phase_mask))
+                || ((event.event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE) && event.runOnce))
                 continue;
 
-            if (eventType == e)
-                if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
-                    ProcessEvent(event, unit, var0, var1, bvar, spell, gob);
+            if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
+            {
+                ProcessEvent(event, unit, var0, var1, bvar, spell, gob);
+                UpdateEventTimerState(event);
+            }
         }
     }
 
@@ -2332,7 +2388,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     {
         SmartScriptHolder& linked = SmartAIMgr::FindLinkedEvent(mEvents, e.link);
         if (linked)
+        {
             ProcessEvent(linked, unit, var0, var1, bvar, spell, gob);
+            UpdateEventTimerState(linked);
+        }
         else
             TC_LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} not found or invalid, skipped.", e.entryOrGuid, e.GetScriptType(), e.event_id, e.link);
     }
@@ -3372,44 +3431,27 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
 
         e.active = true;//activate events with cooldown
 
-        switch (e.GetEventType())//process ONLY timed events
+        if (IsPolledEvent(e.GetEventType()))//process ONLY timed events
         {
-            case SMART_EVENT_UPDATE:
-            case SMART_EVENT_UPDATE_OOC:
-            case SMART_EVENT_UPDATE_IC:
-            case SMART_EVENT_HEALTH_PCT:
-            case SMART_EVENT_MANA_PCT:
-            case SMART_EVENT_RANGE:
-            case SMART_EVENT_VICTIM_CASTING:
-            case SMART_EVENT_FRIENDLY_IS_CC:
-            case SMART_EVENT_FRIENDLY_MISSING_BUFF:
-            case SMART_EVENT_HAS_AURA:
-            case SMART_EVENT_TARGET_BUFFED:
-            case SMART_EVENT_FRIENDLY_HEALTH_PCT:
-            case SMART_EVENT_DISTANCE_CREATURE:
-            case SMART_EVENT_DISTANCE_GAMEOBJECT:
+            if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
             {
-                if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+                Unit* invoker = nullptr;
+                if (me && mTimedActionListInvoker)
+                    invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
+                ProcessEvent(e, invoker);
+                e.enableTimed = false;//disable event if it is in an ActionList and was processed once
+                for (SmartScriptHolder& scriptholder : mTimedActionList)
                 {
-                    Unit* invoker = nullptr;
-                    if (me && mTimedActionListInvoker)
-                        invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
-                    ProcessEvent(e, invoker);
-                    e.enableTimed = false;//disable event if it is in an ActionList and was processed once
-                    for (SmartScriptHolder& scriptholder : mTimedActionList)
+                    //find the first event which is not the current one and enable it
+                    if (scriptholder.event_id > e.event_id)
                     {
-                        //find the first event which is not the current one and enable it
-                        if (scriptholder.event_id > e.event_id)
-                        {
-                            scriptholder.enableTimed = true;
-                            break;
-                        }
+                        scriptholder.enableTimed = true;
+                        break;
                     }
                 }
-                else
-                    ProcessEvent(e);
-                break;
             }
+            else
+                ProcessEvent(e);
         }
 
         if (e.priority != SmartScriptHolder::DEFAULT_PRIORITY)
@@ -3441,6 +3483,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(installevent);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        IndexEvents();
     }
 }
 
@@ -3507,6 +3550,8 @@ bool SmartScript::IsGameObject(WorldObject* obj)
 
 void SmartScript::OnUpdate(uint32 const diff)
 {
+    CreatureUpdateProfiler::SectionTimer profilerTimer(CREATURE_UPDATE_SECTION_SMARTSCRIPT);
+
     if ((mScriptType == SMART_SCRIPT_TYPE_CREATURE || mScriptType == SMART_SCRIPT_TYPE_GAMEOBJECT) && !GetBaseObject())
         return;
 
@@ -3536,11 +3581,15 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        IndexEvents();
         mEventSortingRequired = false;
     }
 
-    for (SmartScriptHolder& mEvent : mEvents)
-        UpdateTimer(mEvent, diff);
+    for (uint32 i = FindNextTickingEvent(0); i < mEvents.size(); i = FindNextTickingEvent(i + 1))
+    {
+        UpdateTimer(mEvents[i], diff);
+        UpdateEventTimerState(mEvents[i]);
+    }
 
     if (!mStoredEvents.empty())
     {
@@ -3598,6 +3647,62 @@ void SmartScript::SortEvents(SmartAIEventList& events)
     std::sort(events.begin(), events.end());
 }
 
+void SmartScript::IndexEvents()
+{
+    mEventTypeOffsets.fill(0);
+    for (SmartScriptHolder const& event : mEvents)
+        if (event.GetEventType() < SMART_EVENT_END)
+            ++mEventTypeOffsets[event.GetEventType() + 1];
+
+    std::partial_sum(mEventTypeOffsets.begin(), mEventTypeOffsets.end(), mEventTypeOffsets.begin());
+
+    std::array<uint32, SMART_EVENT_END> nextPosition;
+    std::copy_n(mEventTypeOffsets.begin(), SMART_EVENT_END, nextPosition.begin());
+    mEventsByType.resize(mEventTypeOffsets[SMART_EVENT_END]);
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+        if (mEvents[i].GetEventType() < SMART_EVENT_END)
+            mEventsByType[nextPosition[mEvents[i].GetEventType()]++] = i;
+
+    mTickingEvents.assign((mEvents.size() + 63) / 64, 0);
+    for (SmartScriptHolder const& event : mEvents)
+        UpdateEventTimerState(event);
+}
+
+void SmartScript::UpdateEventTimerState(SmartScriptHolder const& e)
+{
+    // timed action lists and stored events are updated separately
+    if (std::less<>()(&e, mEvents.data()) || !std::less<>()(&e, mEvents.data() + mEvents.size()))
+        return;
+
+    std::size_t index = &e - mEvents.data();
+    if (index / 64 >= mTickingEvents.size())
+        return;
+
+    uint64 bit = UI64LIT(1) << (index % 64);
+    if (IsTimerIdle(e))
+        mTickingEvents[index / 64] &= ~bit;
+    else
+        mTickingEvents[index / 64] |= bit;
+}
+
+uint32 SmartScript::FindNextTickingEvent(uint32 index) const
+{
+    std::size_t word = index / 64;
+    if (word >= mTickingEvents.size())
+        return uint32(mEvents.size());
+
+    uint64 bits = mTickingEvents[word] & (~UI64LIT(0) << (index % 64));
+    while (!bits)
+    {
+        if (++word >= mTickingEvents.size())
+            return uint32(mEvents.size());
+
+        bits = mTickingEvents[word];
+    }
+
+    return uint32(word * 64 + std::countr_zero(bits));
+}
+
 void SmartScript::RaisePriority(SmartScriptHolder& e)
 {
     e.timer = 1;
@@ -3717,6 +3822,8 @@ void SmartScript::OnInitialize(WorldObject* obj, AreaTriggerEntry const* at)
     for (SmartScriptHolder& event : mEvents)
         InitTimer(event);//calculate timers for first time use
 
+    IndexEvents();
+
     ProcessEventsFor(SMART_EVENT_AI_INIT);
     InstallEvents();
     ProcessEventsFor(SMART_EVENT_JUST_CREATED);
@@ -3851,11 +3958,10 @@ void SmartScript::DecPhase(uint32 p)
 void SmartScript::SetPhase(uint32 p)
 {
     mEventPhase = p;
+    mEventPhaseMask = p ? 1 << (p - 1) : 0;
 }
 
 bool SmartScript::IsInPhase(uint32 p) const
 {
-    if (mEventPhase == 0)
-        return false;
-    return ((1 << (mEventPhase - 1)) & p) != 0;
+    return (mEventPhaseMask & p) != 0;
 }
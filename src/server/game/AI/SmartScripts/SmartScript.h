@@ -20,6 +20,8 @@
 
 #include "Define.h"
 #include "SmartScriptMgr.h"
+#include <array>
+#include <vector>
 
 class Creature;
 class GameObject;
@@ -105,7 +107,16 @@ class TC_GAME_API SmartScript
         void RaisePriority(SmartScriptHolder& e);
         void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
+        void IndexEvents();
+        void UpdateEventTimerState(SmartScriptHolder const& e);
+        uint32 FindNextTickingEvent(uint32 index) const;
+
         SmartAIEventList mEvents;
+        // positions in mEvents grouped by event type, events of type t are [mEventTypeOffsets[t], mEventTypeOffsets[t + 1])
+        std::vector<uint32> mEventsByType;
+        std::array<uint32, SMART_EVENT_END + 1> mEventTypeOffsets;
+        // bit per position in mEvents, set for events UpdateTimer still has to look at
+        std::vector<uint64> mTickingEvents;
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         ObjectGuid mTimedActionListInvoker;
@@ -118,6 +129,7 @@ class TC_GAME_API SmartScript
         AreaTriggerEntry const* trigger;
         SmartScriptType mScriptType;
         uint32 mEventPhase;
+        uint32 mEventPhaseMask;
 
         uint32 mPathId;
         SmartAIEventStoredList mStoredEvents;
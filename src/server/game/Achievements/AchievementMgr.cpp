@@ -45,6 +45,7 @@
 #include "World.h"
 #include "WorldSession.h"
 #include "WowTime.h"
+#include <algorithm>
 
 bool AchievementCriteriaData::IsValid(AchievementCriteriaEntry const* criteria)
 {
@@ -477,7 +478,7 @@ bool AchievementCriteriaDataSet::Meets(Player const* source, WorldObject const*
     return true;
 }
 
-AchievementMgr::AchievementMgr(Player* player) : m_player(player), m_achievementPoints(0)
+AchievementMgr::AchievementMgr(Player* player) : m_player(player), m_achievementPoints(0), m_activeCriteriaOutdated(), m_activeCriteriaTeam(0)
 {
 }
 
@@ -502,6 +503,7 @@ void AchievementMgr::Reset()
     m_completedAchievements.clear();
     m_achievementPoints = 0;
     m_criteriaProgress.clear();
+    ClearActiveCriteria();
     DeleteFromDB(m_player->GetGUID());
 
     // re-fill data
@@ -783,8 +785,11 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     TC_LOG_DEBUG("achievement", "UpdateAchievementCriteria: {}, {} ({}), {}, {}"
         , m_player->GetGUID().ToString(), AchievementGlobalMgr::GetCriteriaTypeString(type), type, miscValue1, miscValue2);
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type, miscValue1);
-    for (AchievementCriteriaEntry const* achievementCriteria : achievementCriteriaList)
+    std::shared_ptr<AchievementCriteriaEntryList const> achievementCriteriaList = GetActiveCriteria(type, miscValue1);
+    if (!achievementCriteriaList)
+        return;
+
+    for (AchievementCriteriaEntry const* achievementCriteria : *achievementCriteriaList)
     {
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->AchievementID);
         if (!CanUpdateCriteria(achievementCriteria, achievement, miscValue1, miscValue2, ref))
@@ -1140,12 +1145,12 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
         // check again the completeness for SUMM and REQ COUNT achievements,
         // as they don't depend on the completed criteria but on the sum of the progress of each individual criteria
         if (achievement->Flags & ACHIEVEMENT_FLAG_SUMM)
-            if (IsCompletedAchievement(achievement))
+            if (!HasAchieved(achievement->ID) && IsCompletedAchievement(achievement))
                 CompletedAchievement(achievement);
 
         if (AchievementEntryList const* achRefList = sAchievementMgr->GetAchievementByReferencedId(achievement->ID))
             for (AchievementEntry const* achievement : *achRefList)
-                if (IsCompletedAchievement(achievement))
+                if (!HasAchieved(achievement->ID) && IsCompletedAchievement(achievement))
                     CompletedAchievement(achievement);
     }
 }
@@ -1406,6 +1411,11 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* entry,
     progress->changed = true;
     progress->date = GameTime::GetGameTime(); // set the date to the latest update.
 
+    if (IsCompletedCriteria(entry, sAchievementStore.LookupEntry(entry->AchievementID)))
+        m_activeCriteriaOutdated[entry->Type] = true;
+    else if (m_inactiveCriteria.erase(entry->ID))
+        m_activeCriteria[entry->Type].clear();
+
     uint32 timeElapsed = 0;
     bool timedCompleted = false;
 
@@ -1438,6 +1448,91 @@ void AchievementMgr::RemoveCriteriaProgress(AchievementCriteriaEntry const* entr
     m_player->SendDirectMessage(&data);
 
     m_criteriaProgress.erase(criteriaProgress);
+
+    if (m_inactiveCriteria.erase(entry->ID))
+        m_activeCriteria[entry->Type].clear();
+}
+
+std::shared_ptr<AchievementCriteriaEntryList const> AchievementMgr::GetActiveCriteria(AchievementCriteriaTypes type, uint32 miscValue)
+{
+    AchievementCriteriaEntryList const& allCriteria = sAchievementMgr->GetAchievementCriteriaByType(type, miscValue);
+    if (allCriteria.empty())
+        return nullptr;
+
+    if (m_activeCriteriaTeam != GetPlayer()->GetTeam())
+    {
+        ClearActiveCriteria();
+        m_activeCriteriaTeam = GetPlayer()->GetTeam();
+    }
+
+    ActiveCriteriaLists& lists = m_activeCriteria[type];
+    if (m_activeCriteriaOutdated[type])
+    {
+        // drop criteria completed since the lists were built
+        for (std::pair<AchievementCriteriaEntryList const* const, std::shared_ptr<AchievementCriteriaEntryList const>>& list : lists)
+        {
+            if (std::all_of(list.second->begin(), list.second->end(), [&](AchievementCriteriaEntry const* criteria) { return IsActiveCriteria(criteria); }))
+                continue;
+
+            std::shared_ptr<AchievementCriteriaEntryList> activeCriteria = std::make_shared<AchievementCriteriaEntryList>();
+            for (AchievementCriteriaEntry const* criteria : *list.second)
+                if (IsActiveCriteria(criteria))
+                    activeCriteria->push_back(criteria);
+
+            list.second = std::move(activeCriteria);
+        }
+
+        m_activeCriteriaOutdated[type] = false;
+    }
+
+    std::shared_ptr<AchievementCriteriaEntryList const>& activeCriteria = lists[&allCriteria];
+    if (!activeCriteria)
+    {
+        std::shared_ptr<AchievementCriteriaEntryList> newList = std::make_shared<AchievementCriteriaEntryList>();
+        for (AchievementCriteriaEntry const* criteria : allCriteria)
+            if (IsActiveCriteria(criteria))
+                newList->push_back(criteria);
+
+        activeCriteria = std::move(newList);
+    }
+
+    if (activeCriteria->empty())
+        return nullptr;
+
+    return activeCriteria;
+}
+
+bool AchievementMgr::IsActiveCriteria(AchievementCriteriaEntry const* criteria)
+{
+    AchievementEntry const* achievement = sAchievementStore.LookupEntry(criteria->AchievementID);
+    if (!achievement)
+        return false;
+
+    // the team doesn't change while logged in
+    if ((achievement->Faction == ACHIEVEMENT_FACTION_HORDE    && GetPlayer()->GetTeam() != HORDE) ||
+        (achievement->Faction == ACHIEVEMENT_FACTION_ALLIANCE && GetPlayer()->GetTeam() != ALLIANCE))
+        return false;
+
+    // realm first criteria stop counting as completed when someone else gets the achievement first
+    if (achievement->Flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+        return true;
+
+    if (IsCompletedCriteria(criteria, achievement))
+    {
+        m_inactiveCriteria.insert(criteria->ID);
+        return false;
+    }
+
+    return true;
+}
+
+void AchievementMgr::ClearActiveCriteria()
+{
+    for (ActiveCriteriaLists& lists : m_activeCriteria)
+        lists.clear();
+
+    m_activeCriteriaOutdated.fill(false);
+    m_inactiveCriteria.clear();
 }
 
 void AchievementMgr::UpdateTimedAchievements(uint32 timeDiff)
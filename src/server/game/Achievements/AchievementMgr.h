@@ -23,8 +23,11 @@
 #include "DBCStores.h"
 #include "Duration.h"
 #include "ObjectGuid.h"
+#include <array>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 class Player;
@@ -305,6 +308,10 @@ class TC_GAME_API AchievementMgr
         bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, uint32 miscValue1, uint32 miscValue2, WorldObject const* ref);
         void BuildAllDataPacket(Player const* receiver, WorldPacket* data) const;
 
+        std::shared_ptr<AchievementCriteriaEntryList const> GetActiveCriteria(AchievementCriteriaTypes type, uint32 miscValue);
+        bool IsActiveCriteria(AchievementCriteriaEntry const* criteria);
+        void ClearActiveCriteria();
+
         bool ConditionsSatisfied(AchievementCriteriaEntry const* criteria) const;
         bool RequirementsSatisfied(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, uint32 miscValue1, uint32 miscValue2, WorldObject const* ref) const;
 
@@ -314,6 +321,14 @@ class TC_GAME_API AchievementMgr
         typedef std::map<uint32, uint32> TimedAchievementMap;
         TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
         uint32 m_achievementPoints;
+
+        // criteria that can still progress for this player, keyed by the list AchievementGlobalMgr::GetAchievementCriteriaByType returns
+        // lists are replaced instead of modified, so an update can keep iterating while criteria complete
+        typedef std::unordered_map<AchievementCriteriaEntryList const*, std::shared_ptr<AchievementCriteriaEntryList const>> ActiveCriteriaLists;
+        std::array<ActiveCriteriaLists, ACHIEVEMENT_CRITERIA_TYPE_TOTAL> m_activeCriteria;
+        std::array<bool, ACHIEVEMENT_CRITERIA_TYPE_TOTAL> m_activeCriteriaOutdated;   // criteria of this type completed since the lists were filtered
+        std::unordered_set<uint32> m_inactiveCriteria;                                // completed criteria left out of m_activeCriteria
+        uint32 m_activeCriteriaTeam;
 };
 
 class TC_GAME_API AchievementGlobalMgr
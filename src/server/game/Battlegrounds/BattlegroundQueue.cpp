@@ -184,7 +184,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group const* group,
 
     //add GroupInfo to m_QueuedGroups
     {
-        m_QueuedGroups[index].push_back(ginfo);
+        EnqueueGroup(ginfo, index);
 
         //announce to world, this code needs mutex
         if (!isRated && !isPremade && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
@@ -276,7 +276,6 @@ uint32 BattlegroundQueue::GetAverageQueueWaitTime(GroupQueueInfo* ginfo) const
 //remove player from queue and from group info, if group info is empty then remove it too
 void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
 {
-    int32 bracket_id = -1;                                     // signed for proper for-loop finish
     QueuedPlayersMap::iterator itr;
 
     //remove player from map, if he's there
@@ -292,37 +291,15 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     }
 
     GroupQueueInfo* group = itr->second.GroupInfo;
-    GroupsQueueType::iterator group_itr;
-    // mostly people with the highest levels are in battlegrounds, thats why
-    // we count from MAX_BATTLEGROUND_QUEUES - 1 to 0
-
-    uint32 index = (group->Team == HORDE) ? BG_QUEUE_PREMADE_HORDE : BG_QUEUE_PREMADE_ALLIANCE;
-
-    //we must check premade and normal team's queue - because when players from premade are joining bg,
-    //they leave groupinfo so we can't use its players size to find out index
-    for (uint32 j = index; j < BG_QUEUE_GROUP_TYPES_COUNT; j += PVP_TEAMS_COUNT)
-    {
-        GroupsQueueType::iterator k = m_QueuedGroups[j].begin();
-        for (; k != m_QueuedGroups[j].end(); ++k)
-        {
-            if ((*k) == group)
-            {
-                bracket_id = m_queueId.BracketId;
-                group_itr = k;
-                //we must store index to be able to erase iterator
-                index = j;
-                break;
-            }
-        }
-    }
 
     //player can't be in queue without group, but just in case
-    if (bracket_id == -1)
+    if (!group || group->QueueIndex >= BG_QUEUE_GROUP_TYPES_COUNT)
     {
         TC_LOG_ERROR("bg.battleground", "BattlegroundQueue: ERROR Cannot find groupinfo for {}", guid.ToString());
         return;
     }
-    TC_LOG_DEBUG("bg.battleground", "BattlegroundQueue: Removing {}, from bracket_id {}", guid.ToString(), (uint32)bracket_id);
+
+    TC_LOG_DEBUG("bg.battleground", "BattlegroundQueue: Removing {}, from bracket_id {}", guid.ToString(), m_queueId.BracketId);
 
     // ALL variables are correctly set
     // We can ignore leveling up in queue - it should not cause crash
@@ -364,7 +341,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info if needed
     if (group->Players.empty())
     {
-        m_QueuedGroups[index].erase(group_itr);
+        DequeueGroup(group);
         delete group;
         return;
     }
@@ -415,6 +392,19 @@ uint32 BattlegroundQueue::GetPlayersInQueue(TeamId id)
     return m_SelectionPools[id].GetPlayerCount();
 }
 
+void BattlegroundQueue::EnqueueGroup(GroupQueueInfo* ginfo, uint32 index, bool front /*= false*/)
+{
+    GroupsQueueType& queue = m_QueuedGroups[index];
+    ginfo->QueueIndex = index;
+    ginfo->QueuePosition = queue.insert(front ? queue.begin() : queue.end(), ginfo);
+}
+
+void BattlegroundQueue::DequeueGroup(GroupQueueInfo* ginfo)
+{
+    m_QueuedGroups[ginfo->QueueIndex].erase(ginfo->QueuePosition);
+    ginfo->QueueIndex = BG_QUEUE_GROUP_TYPES_COUNT;
+}
+
 bool BattlegroundQueue::InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, Team side)
 {
     // set side if needed
@@ -635,8 +625,9 @@ bool BattlegroundQueue::CheckPremadeMatch(uint32 MinPlayersPerTeam, uint32 MaxPl
             if (!(*itr)->IsInvitedToBGInstanceGUID && ((*itr)->JoinTime < time_before || (*itr)->Players.size() < MinPlayersPerTeam))
             {
                 //we must insert group to normal queue and erase pointer from premade queue
-                m_QueuedGroups[BG_QUEUE_NORMAL_ALLIANCE + i].push_front((*itr));
-                m_QueuedGroups[BG_QUEUE_PREMADE_ALLIANCE + i].erase(itr);
+                GroupQueueInfo* ginfo = *itr;
+                DequeueGroup(ginfo);
+                EnqueueGroup(ginfo, BG_QUEUE_NORMAL_ALLIANCE + i, true);
             }
         }
     }
@@ -706,12 +697,9 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(uint32 minPlayersPerTeam)
     //store last ginfo pointer
     GroupQueueInfo* ginfo = m_SelectionPools[teamIndex].SelectedGroups.back();
     //set itr_team to group that was added to selection pool latest
-    GroupsQueueType::iterator itr_team = m_QueuedGroups[uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].begin();
-    for (; itr_team != m_QueuedGroups[uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].end(); ++itr_team)
-        if (ginfo == *itr_team)
-            break;
-    if (itr_team == m_QueuedGroups[uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].end())
+    if (ginfo->QueueIndex != uint32(BG_QUEUE_NORMAL_ALLIANCE) + uint32(teamIndex))
         return false;
+    GroupsQueueType::iterator itr_team = ginfo->QueuePosition;
     GroupsQueueType::iterator itr_team2 = itr_team;
     ++itr_team2;
     //invite players to other selection pool
@@ -729,19 +717,9 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(uint32 minPlayersPerTeam)
     {
         //set correct team
         (*itr)->Team = otherTeamId;
-        //add team to other queue
-        m_QueuedGroups[uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].push_front(*itr);
-        //remove team from old queue
-        GroupsQueueType::iterator itr2 = itr_team;
-        ++itr2;
-        for (; itr2 != m_QueuedGroups[uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].end(); ++itr2)
-        {
-            if (*itr2 == *itr)
-            {
-                m_QueuedGroups[uint8(BG_QUEUE_NORMAL_ALLIANCE) + uint8(teamIndex)].erase(itr2);
-                break;
-            }
-        }
+        //move team to the front of the queue
+        DequeueGroup(*itr);
+        EnqueueGroup(*itr, uint32(BG_QUEUE_NORMAL_ALLIANCE) + uint32(teamIndex), true);
     }
     return true;
 }
@@ -979,13 +957,13 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, bool isRated, u
             // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
             if (aTeam->Team != ALLIANCE)
             {
-                m_QueuedGroups[BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
+                DequeueGroup(aTeam);
+                EnqueueGroup(aTeam, BG_QUEUE_PREMADE_ALLIANCE, true);
             }
             if (hTeam->Team != HORDE)
             {
-                m_QueuedGroups[BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
+                DequeueGroup(hTeam);
+                EnqueueGroup(hTeam, BG_QUEUE_PREMADE_HORDE, true);
             }
 
             arena->SetArenaMatchmakerRating(ALLIANCE, aTeam->ArenaMatchmakerRating);
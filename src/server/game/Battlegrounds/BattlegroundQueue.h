@@ -49,6 +49,8 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  OpponentsTeamRating;                            // for rated arena matches
     uint32  OpponentsMatchmakerRating;                      // for rated arena matches
     uint32  PreviousOpponentsTeamId;                        // excluded from the current queue until the timer is met
+    uint32  QueueIndex;                                     // BattlegroundQueueGroupTypes queue the group is currently in
+    std::list<GroupQueueInfo*>::iterator QueuePosition;     // position in that queue, lets the group leave without a scan
 };
 
 enum BattlegroundQueueGroupTypes
@@ -88,7 +90,7 @@ class TC_GAME_API BattlegroundQueue
         void PlayerInvitedToBGUpdateAverageWaitTime(GroupQueueInfo* ginfo);
         uint32 GetAverageQueueWaitTime(GroupQueueInfo* ginfo) const;
 
-        typedef std::map<ObjectGuid, PlayerQueueInfo> QueuedPlayersMap;
+        typedef std::unordered_map<ObjectGuid, PlayerQueueInfo> QueuedPlayersMap;
         QueuedPlayersMap m_QueuedPlayers;
 
         //do NOT use deque because deque.erase() invalidates ALL iterators
@@ -130,6 +132,11 @@ class TC_GAME_API BattlegroundQueue
         BattlegroundQueueTypeId m_queueId;
 
         bool InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, Team side);
+
+        // all insertions and removals of m_QueuedGroups go through these to keep GroupQueueInfo::QueuePosition valid
+        void EnqueueGroup(GroupQueueInfo* ginfo, uint32 index, bool front = false);
+        void DequeueGroup(GroupQueueInfo* ginfo);
+
         uint32 m_WaitTimes[PVP_TEAMS_COUNT][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
         uint32 m_WaitTimeLastPlayer[PVP_TEAMS_COUNT];
         uint32 m_SumOfWaitTimes[PVP_TEAMS_COUNT];
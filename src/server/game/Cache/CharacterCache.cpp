@@ -22,14 +22,328 @@
 #include "MiscPackets.h"
 #include "Player.h"
 #include "Timer.h"
+#include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    /*
+    Storage layout
+
+    Both lookups (guid and exact name) use open addressing tables of (key, entry) slots with linear probing.
+    Readers never lock: they load the current table and probe it, keys are compared without touching the entry.
+    Writers are serialized by _writeLock, publish new entries and tables with release stores and retire
+    whatever they replaced. Retired memory is freed by ReleaseRetiredEntries() from World::Update, at a point
+    where no map or session update thread can hold a pointer into the cache.
+
+    A slot key never changes once claimed, removing an entry only clears the slot pointer so probe sequences
+    stay intact. Cleared slots are reused when the same key is added again and dropped when the table grows.
+    */
+    struct CacheSlot
+    {
+        std::atomic<uint32> Key;
+        std::atomic<CharacterCacheEntry const*> Entry;
+    };
+
+    struct CacheTable
+    {
+        explicit CacheTable(uint32 capacity) : Mask(capacity - 1), Claimed(0), Slots(std::make_unique<CacheSlot[]>(capacity)) { }
+
+        uint32 Capacity() const { return Mask + 1; }
+
+        uint32 Mask;
+        uint32 Claimed;
+        std::unique_ptr<CacheSlot[]> Slots;
+    };
+
+    constexpr uint32 MinTableCapacity = 1024;
+
+    uint32 TableCapacityFor(std::size_t count)
+    {
+        uint32 capacity = MinTableCapacity;
+        while (capacity < count + count / 2)            // keep load factor below 2/3
+            capacity <<= 1;
+        return capacity;
+    }
+
+    std::vector<CacheTable*> _retiredTables;
+    std::vector<CharacterCacheEntry const*> _retiredEntries;
+
+    class CacheIndex
+    {
+    public:
+        CacheIndex() : _table(new CacheTable(MinTableCapacity)) { }
+        ~CacheIndex() { delete _table.load(std::memory_order_relaxed); }
+
+        template<typename Matcher>
+        CharacterCacheEntry const* Find(uint32 key, Matcher matcher) const
+        {
+            CacheTable const* table = _table.load(std::memory_order_acquire);
+            for (uint32 i = key & table->Mask; ; i = (i + 1) & table->Mask)
+            {
+                CacheSlot const& slot = table->Slots[i];
+                uint32 slotKey = slot.Key.load(std::memory_order_acquire);
+                if (!slotKey)
+                    return nullptr;
+
+                if (slotKey != key)
+                    continue;
+
+                CharacterCacheEntry const* entry = slot.Entry.load(std::memory_order_acquire);
+                if (entry && matcher(*entry))
+                    return entry;
+            }
+        }
+
+        // writer only, returns the replaced entry if there was one
+        template<typename Matcher>
+        CharacterCacheEntry const* Store(uint32 key, CharacterCacheEntry const* entry, Matcher matcher)
+        {
+            CacheTable* table = _table.load(std::memory_order_relaxed);
+            if ((table->Claimed + 1) * 3 > table->Capacity() * 2)
+                table = Grow(table->Capacity() * 2);
+
+            CacheSlot* reusable = nullptr;
+            for (uint32 i = key & table->Mask; ; i = (i + 1) & table->Mask)
+            {
+                CacheSlot& slot = table->Slots[i];
+                uint32 slotKey = slot.Key.load(std::memory_order_relaxed);
+                if (!slotKey)
+                {
+                    if (!reusable)
+                    {
+                        reusable = &slot;
+                        ++table->Claimed;
+                        slot.Key.store(key, std::memory_order_release);
+                    }
+                    break;
+                }
+
+                if (slotKey != key)
+                    continue;
+
+                CharacterCacheEntry const* current = slot.Entry.load(std::memory_order_relaxed);
+                if (!current)
+                {
+                    if (!reusable)
+                        reusable = &slot;
+                }
+                else if (matcher(*current))
+                {
+                    slot.Entry.store(entry, std::memory_order_release);
+                    return current;
+                }
+            }
+
+            reusable->Entry.store(entry, std::memory_order_release);
+            return nullptr;
+        }
+
+        // writer only
+        void Remove(uint32 key, CharacterCacheEntry const* entry)
+        {
+            CacheTable* table = _table.load(std::memory_order_relaxed);
+            for (uint32 i = key & table->Mask; ; i = (i + 1) & table->Mask)
+            {
+                CacheSlot& slot = table->Slots[i];
+                uint32 slotKey = slot.Key.load(std::memory_order_relaxed);
+                if (!slotKey)
+                    return;
+
+                if (slotKey == key && slot.Entry.load(std::memory_order_relaxed) == entry)
+                {
+                    slot.Entry.store(nullptr, std::memory_order_release);
+                    return;
+                }
+            }
+        }
+
+        // writer only, entries are not retired - they are shared between both indexes
+        void Reset(std::size_t expectedCount)
+        {
+            _retiredTables.push_back(_table.exchange(new CacheTable(TableCapacityFor(expectedCount)), std::memory_order_acq_rel));
+        }
+
+        // writer only
+        template<typename Worker>
+        void ForEach(Worker worker) const
+        {
+            CacheTable const* table = _table.load(std::memory_order_relaxed);
+            for (uint32 i = 0; i < table->Capacity(); ++i)
+                if (CharacterCacheEntry const* entry = table->Slots[i].Entry.load(std::memory_order_relaxed))
+                    worker(entry);
+        }
+
+    private:
+        CacheTable* Grow(uint32 capacity)
+        {
+            CacheTable* oldTable = _table.load(std::memory_order_relaxed);
+            CacheTable* newTable = new CacheTable(capacity);
+            for (uint32 i = 0; i < oldTable->Capacity(); ++i)
+            {
+                CharacterCacheEntry const* entry = oldTable->Slots[i].Entry.load(std::memory_order_relaxed);
+                if (!entry)
+                    continue;
+
+                uint32 key = oldTable->Slots[i].Key.load(std::memory_order_relaxed);
+                uint32 j = key & newTable->Mask;
+                while (newTable->Slots[j].Key.load(std::memory_order_relaxed))
+                    j = (j + 1) & newTable->Mask;
+
+                newTable->Slots[j].Key.store(key, std::memory_order_relaxed);
+                newTable->Slots[j].Entry.store(entry, std::memory_order_relaxed);
+                ++newTable->Claimed;
+            }
+
+            _table.store(newTable, std::memory_order_release);
+            _retiredTables.push_back(oldTable);
+            return newTable;
+        }
+
+        std::atomic<CacheTable*> _table;
+    };
+
+    // keys must not be 0, it marks empty slots
+    uint32 GuidKey(ObjectGuid const& guid)
+    {
+        uint32 key = guid.GetCounter() * 2654435761u;
+        return key ? key : 1;
+    }
+
+    uint32 NameKey(std::string_view name)
+    {
+        uint32 key = uint32(std::hash<std::string_view>()(name));
+        return key ? key : 1;
+    }
+
+    std::string FoldName(std::string_view name)
+    {
+        std::wstring wname;
+        if (!Utf8toWStr(name, wname))
+            return std::string(name);
+
+        wstrToLower(wname);
+
+        std::string folded;
+        if (!WStrToUtf8(wname, folded))
+            return std::string(name);
+
+        return folded;
+    }
+
+    typedef std::pair<std::string /*folded name*/, ObjectGuid> PrefixIndexEntry;
+
+    struct PrefixIndexLess
+    {
+        bool operator()(PrefixIndexEntry const& left, PrefixIndexEntry const& right) const { return left < right; }
+        bool operator()(PrefixIndexEntry const& left, std::string_view right) const { return left.first < right; }
+    };
+
+    std::mutex _writeLock;
+    CacheIndex _characterCacheStore;
+    CacheIndex _characterCacheByNameStore;
+    std::size_t _characterCount = 0;
+
+    // completion and GM lookups are rare, a sorted vector of folded names behind a shared lock is enough here
+    std::shared_mutex _prefixIndexLock;
+    std::vector<PrefixIndexEntry> _prefixIndex;
+
+    CharacterCacheEntry const* FindByGuid(ObjectGuid const& guid)
+    {
+        return _characterCacheStore.Find(GuidKey(guid), [&guid](CharacterCacheEntry const& entry) { return entry.Guid == guid; });
+    }
+
+    CharacterCacheEntry const* FindByName(std::string_view name)
+    {
+        return _characterCacheByNameStore.Find(NameKey(name), [name](CharacterCacheEntry const& entry) { return entry.Name == name; });
+    }
+
+    void AddToPrefixIndex(std::string_view name, ObjectGuid const& guid, bool sorted)
+    {
+        PrefixIndexEntry value(FoldName(name), guid);
+        std::unique_lock<std::shared_mutex> lock(_prefixIndexLock);
+        if (sorted)
+            _prefixIndex.insert(std::lower_bound(_prefixIndex.begin(), _prefixIndex.end(), value, PrefixIndexLess()), std::move(value));
+        else
+            _prefixIndex.push_back(std::move(value));
+    }
+
+    void RemoveFromPrefixIndex(std::string_view name, ObjectGuid const& guid)
+    {
+        std::string folded = FoldName(name);
+        std::unique_lock<std::shared_mutex> lock(_prefixIndexLock);
+        auto itr = std::lower_bound(_prefixIndex.begin(), _prefixIndex.end(), PrefixIndexEntry(std::move(folded), guid), PrefixIndexLess());
+        if (itr != _prefixIndex.end() && itr->first == folded && itr->second == guid)
+            _prefixIndex.erase(itr);
+    }
+
+    /// Publishes updated in place of current (both stores), current is freed on the next ReleaseRetiredEntries() call
+    void Replace(CharacterCacheEntry const* current, CharacterCacheEntry const* updated)
+    {
+        _characterCacheStore.Store(GuidKey(updated->Guid), updated, [current](CharacterCacheEntry const& entry) { return &entry == current; });
+
+        if (current->Name == updated->Name)
+            _characterCacheByNameStore.Store(NameKey(updated->Name), updated, [current](CharacterCacheEntry const& entry) { return &entry == current; });
+        else
+        {
+            _characterCacheByNameStore.Remove(NameKey(current->Name), current);
+            if (CharacterCacheEntry const* replaced = _characterCacheByNameStore.Store(NameKey(updated->Name), updated,
+                [updated](CharacterCacheEntry const& entry) { return entry.Name == updated->Name; }))
+                TC_LOG_ERROR("misc", "CharacterCache: name {} is used by both {} and {}", updated->Name, replaced->Guid.ToString(), updated->Guid.ToString());
+        }
+
+        _retiredEntries.push_back(current);
+    }
+
+    template<typename Updater>
+    void UpdateEntry(ObjectGuid const& guid, Updater updater)
+    {
+        std::lock_guard<std::mutex> lock(_writeLock);
+        CharacterCacheEntry const* current = FindByGuid(guid);
+        if (!current)
+            return;
+
+        CharacterCacheEntry* updated = new CharacterCacheEntry(*current);
+        updater(*updated);
+        Replace(current, updated);
+    }
+
+    void AddEntry(ObjectGuid const& guid, uint32 accountId, std::string_view name, uint8 gender, uint8 race, uint8 playerClass, uint8 level, bool sortPrefixIndex)
+    {
+        CharacterCacheEntry* data = new CharacterCacheEntry();
+        data->Guid = guid;
+        data->Name = name;
+        data->AccountId = accountId;
+        data->Race = race;
+        data->Sex = gender;
+        data->Class = playerClass;
+        data->Level = level;
+        data->GuildId = 0;                              // Will be set in guild loading or guild setting
+        for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+            data->ArenaTeamId[i] = 0;                   // Will be set in arena teams loading
+
+        if (CharacterCacheEntry const* current = FindByGuid(guid))
+        {
+            RemoveFromPrefixIndex(current->Name, guid);
+            Replace(current, data);
+        }
+        else
+        {
+            _characterCacheStore.Store(GuidKey(guid), data, [](CharacterCacheEntry const&) { return false; });
+            if (CharacterCacheEntry const* replaced = _characterCacheByNameStore.Store(NameKey(data->Name), data,
+                [data](CharacterCacheEntry const& entry) { return entry.Name == data->Name; }))
+                TC_LOG_ERROR("misc", "CharacterCache: name {} is used by both {} and {}", data->Name, replaced->Guid.ToString(), guid.ToString());
+            ++_characterCount;
+        }
+
+        AddToPrefixIndex(name, guid, sortPrefixIndex);
+    }
 }
 
 CharacterCache::CharacterCache()
@@ -69,111 +383,140 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
-    _characterCacheStore.clear();
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
-    if (!result)
+    std::size_t expectedCount = 0;
+    if (QueryResult result = CharacterDatabase.Query("SELECT COUNT(*) FROM characters"))
+        expectedCount = std::size_t((*result)[0].GetUInt64());
+
+    std::lock_guard<std::mutex> lock(_writeLock);
+
+    _characterCacheStore.ForEach([](CharacterCacheEntry const* entry) { _retiredEntries.push_back(entry); });
+    _characterCacheStore.Reset(expectedCount);
+    _characterCacheByNameStore.Reset(expectedCount);
+    _characterCount = 0;
     {
-        TC_LOG_INFO("server.loading", "No character name data loaded, empty query");
-        return;
+        std::unique_lock<std::shared_mutex> prefixLock(_prefixIndexLock);
+        _prefixIndex.clear();
+        _prefixIndex.reserve(expectedCount);
+    }
+
+    // Stream the table in guid ordered pages instead of materializing every row at once
+    constexpr uint32 PageSize = 50000;
+    ObjectGuid::LowType lastGuid = 0;
+    while (QueryResult result = CharacterDatabase.PQuery("SELECT guid, name, account, race, gender, class, level FROM characters WHERE guid > {} ORDER BY guid LIMIT {}", lastGuid, PageSize))
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            lastGuid = fields[0].GetUInt32();
+            AddEntry(ObjectGuid::Create<HighGuid::Player>(lastGuid) /*guid*/, fields[2].GetUInt32() /*account*/, fields[1].GetStringView() /*name*/,
+                fields[4].GetUInt8() /*gender*/, fields[3].GetUInt8() /*race*/, fields[5].GetUInt8() /*class*/, fields[6].GetUInt8() /*level*/, false);
+        } while (result->NextRow());
+
+        if (result->GetRowCount() < PageSize)
+            break;
     }
 
-    do
     {
-        Field* fields = result->Fetch();
-        AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt32()) /*guid*/, fields[2].GetUInt32() /*account*/, fields[1].GetString() /*name*/,
-            fields[4].GetUInt8() /*gender*/, fields[3].GetUInt8() /*race*/, fields[5].GetUInt8() /*class*/, fields[6].GetUInt8() /*level*/);
-    } while (result->NextRow());
+        std::unique_lock<std::shared_mutex> prefixLock(_prefixIndexLock);
+        std::sort(_prefixIndex.begin(), _prefixIndex.end(), PrefixIndexLess());
+    }
 
-    TC_LOG_INFO("server.loading", "Loaded character infos for {} characters in {} ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    if (!_characterCount)
+    {
+        TC_LOG_INFO("server.loading", "No character name data loaded, empty query");
+        return;
+    }
+
+    TC_LOG_INFO("server.loading", "Loaded character infos for {} characters in {} ms", _characterCount, GetMSTimeDiffToNow(oldMSTime));
 }
 
 /*
 Modifying functions
 */
-void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
+void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string_view name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
-    data.Name = name;
-    data.AccountId = accountId;
-    data.Race = race;
-    data.Sex = gender;
-    data.Class = playerClass;
-    data.Level = level;
-    data.GuildId = 0;                           // Will be set in guild loading or guild setting
-    for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
-        data.ArenaTeamId[i] = 0;                // Will be set in arena teams loading
-
-    // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    std::lock_guard<std::mutex> lock(_writeLock);
+    AddEntry(guid, accountId, name, gender, race, playerClass, level, true);
 }
 
-void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
+void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string_view /*name*/)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    std::lock_guard<std::mutex> lock(_writeLock);
+    if (CharacterCacheEntry const* current = FindByGuid(guid))
+    {
+        _characterCacheStore.Remove(GuidKey(guid), current);
+        _characterCacheByNameStore.Remove(NameKey(current->Name), current);
+        RemoveFromPrefixIndex(current->Name, guid);
+        _retiredEntries.push_back(current);
+        --_characterCount;
+    }
 }
 
-void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
+void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string_view name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
+    {
+        std::lock_guard<std::mutex> lock(_writeLock);
+        CharacterCacheEntry const* current = FindByGuid(guid);
+        if (!current)
+            return;
+
+        CharacterCacheEntry* updated = new CharacterCacheEntry(*current);
+        if (name != current->Name)
+        {
+            updated->Name = name;
+
+            // Correct name -> pointer storage
+            RemoveFromPrefixIndex(current->Name, guid);
+            AddToPrefixIndex(name, guid, true);
+        }
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+        if (gender)
+            updated->Sex = *gender;
 
-    if (gender)
-        itr->second.Sex = *gender;
+        if (race)
+            updated->Race = *race;
 
-    if (race)
-        itr->second.Race = *race;
+        Replace(current, updated);
+    }
 
     WorldPackets::Misc::InvalidatePlayer packet(guid);
     sWorld->SendGlobalMessage(packet.Write());
-
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.Level = level;
+    UpdateEntry(guid, [level](CharacterCacheEntry& entry) { entry.Level = level; });
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.AccountId = accountId;
+    UpdateEntry(guid, [accountId](CharacterCacheEntry& entry) { entry.AccountId = accountId; });
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.GuildId = guildId;
+    UpdateEntry(guid, [guildId](CharacterCacheEntry& entry) { entry.GuildId = guildId; });
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
     ASSERT(slot < 3);
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    UpdateEntry(guid, [slot, arenaTeamId](CharacterCacheEntry& entry) { entry.ArenaTeamId[slot] = arenaTeamId; });
+}
+
+void CharacterCache::ReleaseRetiredEntries()
+{
+    std::lock_guard<std::mutex> lock(_writeLock);
+
+    for (CharacterCacheEntry const* entry : _retiredEntries)
+        delete entry;
+    _retiredEntries.clear();
+
+    for (CacheTable* table : _retiredTables)
+        delete table;
+    _retiredTables.clear();
 }
 
 /*
@@ -181,98 +524,102 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return FindByGuid(guid) != nullptr;
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
-        return &itr->second;
+    return FindByGuid(guid);
+}
 
-    return nullptr;
+CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string_view name) const
+{
+    return FindByName(name);
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
+std::vector<CharacterCacheEntry const*> CharacterCache::GetCharacterCacheByNamePrefix(std::string_view prefix, std::size_t maxResults) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second;
+    std::vector<CharacterCacheEntry const*> entries;
+    std::string folded = FoldName(prefix);
+
+    std::shared_lock<std::shared_mutex> lock(_prefixIndexLock);
+    for (auto itr = std::lower_bound(_prefixIndex.begin(), _prefixIndex.end(), std::string_view(folded), PrefixIndexLess());
+        itr != _prefixIndex.end() && entries.size() < maxResults && StringStartsWith(itr->first, folded); ++itr)
+        if (CharacterCacheEntry const* entry = FindByGuid(itr->second))
+            entries.push_back(entry);
 
-    return nullptr;
+    return entries;
 }
 
-ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
+ObjectGuid CharacterCache::GetCharacterGuidByName(std::string_view name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->Guid;
+    if (CharacterCacheEntry const* entry = FindByName(name))
+        return entry->Guid;
 
     return ObjectGuid::Empty;
 }
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* entry = FindByGuid(guid);
+    if (!entry)
         return false;
 
-    name = itr->second.Name;
+    name = entry->Name;
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* entry = FindByGuid(guid);
+    if (!entry)
         return 0;
 
-    return Player::TeamForRace(itr->second.Race);
+    return Player::TeamForRace(entry->Race);
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* entry = FindByGuid(guid);
+    if (!entry)
         return 0;
 
-    return itr->second.AccountId;
+    return entry->AccountId;
 }
 
-uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
+uint32 CharacterCache::GetCharacterAccountIdByName(std::string_view name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->AccountId;
+    if (CharacterCacheEntry const* entry = FindByName(name))
+        return entry->AccountId;
 
     return 0;
 }
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* entry = FindByGuid(guid);
+    if (!entry)
         return 0;
 
-    return itr->second.Level;
+    return entry->Level;
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* entry = FindByGuid(guid);
+    if (!entry)
         return 0;
 
-    return itr->second.GuildId;
+    return entry->GuildId;
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* entry = FindByGuid(guid);
+    if (!entry)
         return 0;
 
     uint8 slot = ArenaTeam::GetSlotByType(type);
     ASSERT(slot < 3);
-    return itr->second.ArenaTeamId[slot];
+    return entry->ArenaTeamId[slot];
 }
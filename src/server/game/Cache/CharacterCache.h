@@ -22,11 +22,15 @@
 #include "ObjectGuid.h"
 #include "Optional.h"
 #include <string>
+#include <string_view>
+#include <vector>
 
+/// Entries are immutable once published, every update replaces the entry and the old one is released
+/// by ReleaseRetiredEntries() - pointers returned by the getters must not be kept past the current world tick
 struct CharacterCacheEntry
 {
     ObjectGuid Guid;
-    std::string Name;
+    std::string Name;                           // short names stay inside the entry allocation (small string optimization)
     uint32 AccountId;
     uint8 Class;
     uint8 Race;
@@ -44,24 +48,29 @@ class TC_GAME_API CharacterCache
         static CharacterCache* instance();
 
         void LoadCharacterCacheStorage();
-        void AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level);
-        void DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name);
+        void AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string_view name, uint8 gender, uint8 race, uint8 playerClass, uint8 level);
+        void DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string_view name);
 
-        void UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender = {}, Optional<uint8> race = {});
+        void UpdateCharacterData(ObjectGuid const& guid, std::string_view name, Optional<uint8> gender = {}, Optional<uint8> race = {});
         void UpdateCharacterLevel(ObjectGuid const& guid, uint8 level);
         void UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId);
         void UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId);
         void UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId);
 
+        /// Frees entries replaced since the last call, must only be called while no other thread reads the cache
+        void ReleaseRetiredEntries();
+
         bool HasCharacterCacheEntry(ObjectGuid const& guid) const;
         CharacterCacheEntry const* GetCharacterCacheByGuid(ObjectGuid const& guid) const;
-        CharacterCacheEntry const* GetCharacterCacheByName(std::string const& name) const;
+        CharacterCacheEntry const* GetCharacterCacheByName(std::string_view name) const;
+        /// Case insensitive, results are ordered by name
+        std::vector<CharacterCacheEntry const*> GetCharacterCacheByNamePrefix(std::string_view prefix, std::size_t maxResults) const;
 
-        ObjectGuid GetCharacterGuidByName(std::string const& name) const;
+        ObjectGuid GetCharacterGuidByName(std::string_view name) const;
         bool GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const;
         uint32 GetCharacterTeamByGuid(ObjectGuid guid) const;
         uint32 GetCharacterAccountIdByGuid(ObjectGuid guid) const;
-        uint32 GetCharacterAccountIdByName(std::string const& name) const;
+        uint32 GetCharacterAccountIdByName(std::string_view name) const;
         uint8 GetCharacterLevelByGuid(ObjectGuid guid) const;
         ObjectGuid::LowType GetCharacterGuildIdByGuid(ObjectGuid guid) const;
         uint32 GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const;
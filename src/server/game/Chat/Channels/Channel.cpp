@@ -202,7 +202,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     if (newChannel)
         _nextActivityUpdateTime = 0; // force activity update on next channel tick
 
-    PlayerInfo& pinfo = _playersStore[guid];
+    PlayerInfo& pinfo = AddMember(guid);
     pinfo.flags = MEMBER_FLAG_NONE;
     pinfo.invisible = !player->isGMVisible();
 
@@ -251,9 +251,9 @@ void Channel::LeaveChannel(Player* player, bool send)
         player->LeftChannel(this);
     }
 
-    PlayerInfo& info = _playersStore.at(guid);
+    PlayerInfo& info = GetMember(guid);
     bool changeowner = info.IsOwner();
-    _playersStore.erase(guid);
+    RemoveMember(guid);
 
     if (_announceEnabled && !player->GetSession()->HasPermission(rbac::RBAC_PERM_SILENTLY_JOIN_CHANNEL))
     {
@@ -304,7 +304,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
         return;
     }
 
-    PlayerInfo& info = _playersStore.at(good);
+    PlayerInfo& info = GetMember(good);
     if (!info.IsModerator() && !player->GetSession()->HasPermission(rbac::RBAC_PERM_CHANGE_CHANNEL_NOT_MODERATOR))
     {
         NotModeratorAppend appender;
@@ -352,14 +352,25 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
         SendToAll(builder);
     }
 
-    _playersStore.erase(victim);
+    RemoveMember(victim);
     bad->LeftChannel(this);
 
     if (changeowner && _ownershipEnabled && !_playersStore.empty())
     {
-        ObjectGuid newowner = good;
-        info.SetModerator(true);
-        SetOwner(newowner);
+        // removing the victim may have moved our entry, and an owner kicking themselves has none left
+        auto itr = FindMember(good);
+        if (itr == _playersStore.end())
+        {
+            itr = std::find_if(_playersStore.begin(), _playersStore.end(), [](PlayerContainer::value_type const& member) { return !member.second.IsInvisible(); });
+            if (itr == _playersStore.end())
+                itr = _playersStore.begin();
+        }
+
+        itr->second.SetModerator(true);
+        SetOwner(itr->first);
+
+        if (itr->second.IsInvisible())
+            _isOwnerInvisible = true;
     }
 }
 
@@ -375,7 +386,7 @@ void Channel::UnBan(Player const* player, std::string const& badname)
         return;
     }
 
-    PlayerInfo& info = _playersStore.at(good);
+    PlayerInfo& info = GetMember(good);
     if (!info.IsModerator() && !player->GetSession()->HasPermission(rbac::RBAC_PERM_CHANGE_CHANNEL_NOT_MODERATOR))
     {
         NotModeratorAppend appender;
@@ -417,7 +428,7 @@ void Channel::Password(Player const* player, std::string const& pass)
         return;
     }
 
-    PlayerInfo& info = _playersStore.at(guid);
+    PlayerInfo& info = GetMember(guid);
     if (!info.IsModerator() && !player->GetSession()->HasPermission(rbac::RBAC_PERM_CHANGE_CHANNEL_NOT_MODERATOR))
     {
         NotModeratorAppend appender;
@@ -447,7 +458,7 @@ void Channel::SetMode(Player const* player, std::string const& p2n, bool mod, bo
         return;
     }
 
-    PlayerInfo& info = _playersStore.at(guid);
+    PlayerInfo& info = GetMember(guid);
     if (!info.IsModerator() && !player->GetSession()->HasPermission(rbac::RBAC_PERM_CHANGE_CHANNEL_NOT_MODERATOR))
     {
         NotModeratorAppend appender;
@@ -489,7 +500,7 @@ void Channel::SetMode(Player const* player, std::string const& p2n, bool mod, bo
 
 void Channel::SetInvisible(Player const* player, bool on)
 {
-    auto itr = _playersStore.find(player->GetGUID());
+    auto itr = FindMember(player->GetGUID());
     if (itr == _playersStore.end())
         return;
 
@@ -505,7 +516,7 @@ void Channel::SetModerator(ObjectGuid guid, bool set)
     if (!IsOn(guid))
         return;
 
-    PlayerInfo& playerInfo = _playersStore.at(guid);
+    PlayerInfo& playerInfo = GetMember(guid);
     if (playerInfo.IsModerator() != set)
     {
         uint8 oldFlag = GetPlayerFlags(guid);
@@ -522,7 +533,7 @@ void Channel::SetMute(ObjectGuid guid, bool set)
     if (!IsOn(guid))
         return;
 
-    PlayerInfo& playerInfo = _playersStore.at(guid);
+    PlayerInfo& playerInfo = GetMember(guid);
     if (playerInfo.IsMuted() != set)
     {
         uint8 oldFlag = GetPlayerFlags(guid);
@@ -568,7 +579,7 @@ void Channel::SetOwner(Player const* player, std::string const& newname)
         return;
     }
 
-    PlayerInfo& info = _playersStore.at(victim);
+    PlayerInfo& info = GetMember(victim);
     info.SetModerator(true);
     SetOwner(victim);
 }
@@ -616,22 +627,19 @@ void Channel::List(Player const* player) const
     uint32 gmLevelInWhoList = sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST);
 
     uint32 count  = 0;
-    for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
+    ForEachConnectedMember([&](PlayerContainer::value_type const& info, Player* member)
     {
-        Player* member = ObjectAccessor::FindConnectedPlayer(i->first);
-
         // PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
         // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-        if (member &&
-            (player->GetSession()->HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS) ||
+        if ((player->GetSession()->HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS) ||
              member->GetSession()->GetSecurity() <= AccountTypes(gmLevelInWhoList)) &&
             member->IsVisibleGloballyFor(player))
         {
-            data << uint64(i->first);
-            data << uint8(i->second.flags);             // flags seems to be changed...
+            data << uint64(info.first);
+            data << uint8(info.second.flags);           // flags seems to be changed...
             ++count;
         }
-    }
+    });
 
     data.put<uint32>(pos, count);
     player->SendDirectMessage(&data);
@@ -649,7 +657,7 @@ void Channel::Announce(Player const* player)
         return;
     }
 
-    PlayerInfo& info = _playersStore.at(guid);
+    PlayerInfo& info = GetMember(guid);
     if (!info.IsModerator() && !player->GetSession()->HasPermission(rbac::RBAC_PERM_CHANGE_CHANNEL_NOT_MODERATOR))
     {
         NotModeratorAppend appender;
@@ -693,7 +701,7 @@ void Channel::Say(ObjectGuid guid, std::string const& what, uint32 lang) const
         return;
     }
 
-    PlayerInfo const& info = _playersStore.at(guid);
+    PlayerInfo const& info = GetMember(guid);
     if (info.IsMuted())
     {
         MutedAppend appender;
@@ -778,7 +786,7 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 {
     if (_ownerGuid)
     {
-        auto itr = _playersStore.find(_ownerGuid);
+        auto itr = FindMember(_ownerGuid);
         if (itr != _playersStore.end())
             itr->second.SetOwner(false);
     }
@@ -787,7 +795,7 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
     if (_ownerGuid)
     {
         uint8 oldFlag = GetPlayerFlags(_ownerGuid);
-        auto itr = _playersStore.find(_ownerGuid);
+        auto itr = FindMember(_ownerGuid);
         if (itr == _playersStore.end())
             return;
 
@@ -858,15 +866,37 @@ void Channel::LeaveNotify(ObjectGuid guid) const
         SendToAll(builder);
 }
 
+template<class Worker>
+void Channel::ForEachConnectedMember(Worker&& worker) const
+{
+    std::vector<Player*> members;
+    members.reserve(_playersStore.size());
+
+    {
+        std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
+        HashMapHolder<Player>::MapType const& players = ObjectAccessor::GetPlayers();
+        for (PlayerContainer::value_type const& member : _playersStore)
+        {
+            auto itr = players.find(member.first);
+            members.push_back(itr != players.end() ? itr->second : nullptr);
+        }
+    }
+
+    for (std::size_t i = 0; i < members.size(); ++i)
+        if (members[i])
+            worker(_playersStore[i], members[i]);
+}
+
 template<class Builder>
 void Channel::SendToAll(Builder& builder, ObjectGuid guid /*= ObjectGuid::Empty*/) const
 {
     Trinity::LocalizedPacketDo<Builder> localizer(builder);
 
-    for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-            if (!guid || !player->GetSocial()->HasIgnore(guid))
-                localizer(player);
+    ForEachConnectedMember([&](PlayerContainer::value_type const& /*member*/, Player* player)
+    {
+        if (!guid || !player->GetSocial()->HasIgnore(guid))
+            localizer(player);
+    });
 }
 
 template<class Builder>
@@ -874,10 +904,11 @@ void Channel::SendToAllButOne(Builder& builder, ObjectGuid who) const
 {
     Trinity::LocalizedPacketDo<Builder> localizer(builder);
 
-    for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
-        if (i->first != who)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-                localizer(player);
+    ForEachConnectedMember([&](PlayerContainer::value_type const& member, Player* player)
+    {
+        if (member.first != who)
+            localizer(player);
+    });
 }
 
 template<class Builder>
@@ -888,3 +919,44 @@ void Channel::SendToOne(Builder& builder, ObjectGuid who) const
     if (Player* player = ObjectAccessor::FindConnectedPlayer(who))
         localizer(player);
 }
+
+Channel::PlayerContainer::iterator Channel::FindMember(ObjectGuid guid)
+{
+    auto itr = std::lower_bound(_playersStore.begin(), _playersStore.end(), guid, [](PlayerContainer::value_type const& member, ObjectGuid guid) { return member.first < guid; });
+    return itr != _playersStore.end() && itr->first == guid ? itr : _playersStore.end();
+}
+
+Channel::PlayerContainer::const_iterator Channel::FindMember(ObjectGuid guid) const
+{
+    auto itr = std::lower_bound(_playersStore.begin(), _playersStore.end(), guid, [](PlayerContainer::value_type const& member, ObjectGuid guid) { return member.first < guid; });
+    return itr != _playersStore.end() && itr->first == guid ? itr : _playersStore.end();
+}
+
+Channel::PlayerInfo& Channel::GetMember(ObjectGuid guid)
+{
+    auto itr = FindMember(guid);
+    ASSERT(itr != _playersStore.end(), "Player %s is not a member of channel %s", guid.ToString().c_str(), _channelName.c_str());
+    return itr->second;
+}
+
+Channel::PlayerInfo const& Channel::GetMember(ObjectGuid guid) const
+{
+    auto itr = FindMember(guid);
+    ASSERT(itr != _playersStore.end(), "Player %s is not a member of channel %s", guid.ToString().c_str(), _channelName.c_str());
+    return itr->second;
+}
+
+Channel::PlayerInfo& Channel::AddMember(ObjectGuid guid)
+{
+    auto itr = std::lower_bound(_playersStore.begin(), _playersStore.end(), guid, [](PlayerContainer::value_type const& member, ObjectGuid guid) { return member.first < guid; });
+    if (itr == _playersStore.end() || itr->first != guid)
+        itr = _playersStore.emplace(itr, guid, PlayerInfo());
+    return itr->second;
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    auto itr = FindMember(guid);
+    if (itr != _playersStore.end())
+        _playersStore.erase(itr);
+}
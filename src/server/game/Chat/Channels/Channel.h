@@ -21,8 +21,8 @@
 #include "Common.h"
 #include "ObjectGuid.h"
 #include <ctime>
-#include <map>
 #include <unordered_set>
+#include <vector>
 
 class Player;
 struct AreaTableEntry;
@@ -222,21 +222,33 @@ class TC_GAME_API Channel
         template<class Builder>
         void SendToOne(Builder& builder, ObjectGuid who) const;
 
-        bool IsOn(ObjectGuid who) const { return _playersStore.find(who) != _playersStore.end(); }
+        // calls worker for every member that is currently connected, the player map is locked once for the whole batch
+        template<class Worker>
+        void ForEachConnectedMember(Worker&& worker) const;
+
+        bool IsOn(ObjectGuid who) const { return FindMember(who) != _playersStore.end(); }
         bool IsBanned(ObjectGuid guid) const { return _bannedStore.find(guid) != _bannedStore.end(); }
 
         uint8 GetPlayerFlags(ObjectGuid guid) const
         {
-            PlayerContainer::const_iterator itr = _playersStore.find(guid);
+            auto itr = FindMember(guid);
             return itr != _playersStore.end() ? itr->second.flags : 0;
         }
 
         void SetModerator(ObjectGuid guid, bool set);
         void SetMute(ObjectGuid guid, bool set);
 
-        typedef std::map<ObjectGuid, PlayerInfo> PlayerContainer;
+        // members sorted by guid, kept flat so broadcasts to big world channels walk contiguous memory
+        typedef std::vector<std::pair<ObjectGuid, PlayerInfo>> PlayerContainer;
         typedef GuidUnorderedSet BannedContainer;
 
+        PlayerContainer::iterator FindMember(ObjectGuid guid);
+        PlayerContainer::const_iterator FindMember(ObjectGuid guid) const;
+        PlayerInfo& GetMember(ObjectGuid guid);
+        PlayerInfo const& GetMember(ObjectGuid guid) const;
+        PlayerInfo& AddMember(ObjectGuid guid);
+        void RemoveMember(ObjectGuid guid);
+
         bool _isDirty; // whether the channel needs to be saved to DB
         time_t _nextActivityUpdateTime;
 
@@ -33,6 +33,7 @@
 #include "SpellAuras.h"
 #include "SpellMgr.h"
 #include "World.h"
+#include <algorithm>
 
 char const* const ConditionMgr::StaticSourceTypeData[CONDITION_SOURCE_TYPE_MAX] =
 {
@@ -832,52 +833,284 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionContainer cons
     return mask;
 }
 
-bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
+/*
+ * Condition list compiled for evaluation.
+ * Else groups are stored one after another in ascending ElseGroup order, GroupEnds holds the end
+ * of every group in Steps. References to single group lists are inlined into the referencing group,
+ * other references stay nested programs. Inside a group steps are ordered by evaluation cost,
+ * Order keeps the position the interpreter would have checked a step at, so the reported failed
+ * condition stays the same.
+ */
+struct ConditionProgram
+{
+    enum Cost : uint8
+    {
+        COST_FIELD  = 0,    // reads fields of the checked object
+        COST_LOOKUP = 1,    // searches containers owned by the object or global stores
+        COST_SEARCH = 2     // grid searches and terrain queries
+    };
+
+    struct Step
+    {
+        Condition const* Check = nullptr;                   // nullptr for nested programs and broken references
+        std::shared_ptr<ConditionProgram const> Reference;
+        uint32 Order = 0;
+        uint8 Cost = COST_FIELD;
+    };
+
+    std::vector<Step> Steps;
+    std::vector<uint32> GroupEnds;
+    ConditionSourceType SourceType = CONDITION_SOURCE_TYPE_NONE;
+    uint32 OrderSpan = 0;           // number of Order values used by this program
+    uint8 MaxCost = COST_FIELD;
+    bool HasErrorTypes = false;     // failures are shown to players, the failing condition must not change
+};
+
+namespace
+{
+    uint8 GetConditionCost(ConditionTypes type)
+    {
+        switch (type)
+        {
+            case CONDITION_NEAR_CREATURE:
+            case CONDITION_NEAR_GAMEOBJECT:
+            case CONDITION_IN_WATER:
+                return ConditionProgram::COST_SEARCH;
+            case CONDITION_AURA:
+            case CONDITION_ITEM:
+            case CONDITION_ITEM_EQUIPPED:
+            case CONDITION_REPUTATION_RANK:
+            case CONDITION_SKILL:
+            case CONDITION_QUESTREWARDED:
+            case CONDITION_QUESTTAKEN:
+            case CONDITION_WORLD_STATE:
+            case CONDITION_ACTIVE_EVENT:
+            case CONDITION_INSTANCE_INFO:
+            case CONDITION_QUEST_NONE:
+            case CONDITION_ACHIEVEMENT:
+            case CONDITION_SPELL:
+            case CONDITION_QUEST_COMPLETE:
+            case CONDITION_RELATION_TO:
+            case CONDITION_REACTION_TO:
+            case CONDITION_REALM_ACHIEVEMENT:
+            case CONDITION_DAILY_QUEST_DONE:
+            case CONDITION_QUESTSTATE:
+            case CONDITION_QUEST_OBJECTIVE_PROGRESS:
+            case CONDITION_ZONEID:
+            case CONDITION_AREAID:
+                return ConditionProgram::COST_LOOKUP;
+            default:
+                return ConditionProgram::COST_FIELD;
+        }
+    }
+
+    // reference ids being compiled on this thread, used to break reference cycles
+    thread_local std::vector<uint32> CompilingReferences;
+}
+
+ConditionContainer::ConditionContainer() = default;
+
+ConditionContainer::ConditionContainer(ConditionContainer const& right) : _conditions(right._conditions), _program(right._program.load(std::memory_order_acquire))
+{
+}
+
+ConditionContainer& ConditionContainer::operator=(ConditionContainer const& right)
+{
+    if (this != &right)
+    {
+        _conditions = right._conditions;
+        _program.store(right._program.load(std::memory_order_acquire), std::memory_order_release);
+    }
+    return *this;
+}
+
+ConditionContainer::~ConditionContainer() = default;
+
+void ConditionContainer::push_back(Condition* condition)
+{
+    _conditions.push_back(condition);
+    _program.store(nullptr, std::memory_order_release);
+}
+
+void ConditionContainer::clear()
+{
+    _conditions.clear();
+    _program.store(nullptr, std::memory_order_release);
+}
+
+std::shared_ptr<ConditionProgram const> ConditionContainer::GetProgram() const
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> elseGroupStore;
+    std::shared_ptr<ConditionProgram const> program = _program.load(std::memory_order_acquire);
+    if (!program)
+    {
+        // lists are compiled on first use, concurrent compiles of the same list produce equal programs
+        std::shared_ptr<ConditionProgram const> compiled = sConditionMgr->CompileConditions(*this);
+        if (_program.compare_exchange_strong(program, compiled, std::memory_order_acq_rel))
+            program = std::move(compiled);
+    }
+    return program;
+}
+
+std::shared_ptr<ConditionProgram const> ConditionMgr::CompileConditions(ConditionContainer const& conditions) const
+{
+    std::shared_ptr<ConditionProgram> program = std::make_shared<ConditionProgram>();
+
+    //     groupId, steps
+    std::map<uint32, std::vector<ConditionProgram::Step>> elseGroups;
     for (Condition const* condition : conditions)
     {
-        TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} val1: {}", condition->ToString(), condition->ConditionValue1);
-        if (condition->isLoaded())
-        {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = elseGroupStore.find(condition->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == elseGroupStore.end())
-                elseGroupStore[condition->ElseGroup] = true;
-            else if (!(*itr).second) //! If another condition in this group was unmatched before this, don't bother checking (the group is false anyway)
-                continue;
+        if (!condition->isLoaded())
+            continue;
+
+        if (program->SourceType == CONDITION_SOURCE_TYPE_NONE && condition->SourceType < CONDITION_SOURCE_TYPE_MAX)
+            program->SourceType = condition->SourceType;
+
+        std::vector<ConditionProgram::Step>& steps = elseGroups[condition->ElseGroup];
+        if (!condition->ReferenceId)
+        {
+            ConditionProgram::Step& step = steps.emplace_back();
+            step.Check = condition;
+            step.Order = program->OrderSpan++;
+            step.Cost = GetConditionCost(condition->ConditionType);
+            program->HasErrorTypes = program->HasErrorTypes || condition->ErrorType;
+            continue;
+        }
+
+        ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
+        if (ref == ConditionReferenceStore.end())
+        {
+            // checked at loading, should never happen. The interpreter ignored such references, so do we
+            TC_LOG_DEBUG("condition", "ConditionMgr::CompileConditions {} Reference template -{} not found",
+                condition->ToString(), condition->ReferenceId);
+            continue;
+        }
+
+        if (std::find(CompilingReferences.begin(), CompilingReferences.end(), condition->ReferenceId) != CompilingReferences.end())
+        {
+            TC_LOG_ERROR("condition", "ConditionMgr::CompileConditions {} Reference template -{} references itself, the reference never matches",
+                condition->ToString(), condition->ReferenceId);
+            ConditionProgram::Step& step = steps.emplace_back();
+            step.Order = program->OrderSpan++;
+            continue;
+        }
+
+        CompilingReferences.push_back(condition->ReferenceId);
+        std::shared_ptr<ConditionProgram const> reference = ref->second.GetProgram();
+        CompilingReferences.pop_back();
 
-            if (condition->ReferenceId)//handle reference
+        program->HasErrorTypes = program->HasErrorTypes || reference->HasErrorTypes;
+        if (reference->GroupEnds.size() == 1)
+        {
+            // single group, its conditions simply become part of the referencing group
+            for (ConditionProgram::Step step : reference->Steps)
             {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
-                {
-                    if (!IsObjectMeetToConditionList(sourceInfo, ref->second))
-                        elseGroupStore[condition->ElseGroup] = false;
-                }
-                else
-                {
-                    TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
-                        condition->ToString(), condition->ReferenceId); // checked at loading, should never happen
-                }
+                step.Order += program->OrderSpan;
+                steps.push_back(std::move(step));
+            }
+        }
+        else
+        {
+            ConditionProgram::Step& step = steps.emplace_back();
+            step.Reference = reference;
+            step.Order = program->OrderSpan;
+            step.Cost = reference->MaxCost;
+        }
+        program->OrderSpan += std::max<uint32>(reference->OrderSpan, 1);
+    }
+
+    for (auto& [elseGroup, steps] : elseGroups)
+    {
+        bool hasErrorTypes = std::any_of(steps.begin(), steps.end(), [](ConditionProgram::Step const& step)
+        {
+            return (step.Check && step.Check->ErrorType) || (step.Reference && step.Reference->HasErrorTypes);
+        });
+
+        // cheap checks first, the first failing one ends the group
+        if (!hasErrorTypes)
+            std::stable_sort(steps.begin(), steps.end(), [](ConditionProgram::Step const& left, ConditionProgram::Step const& right)
+            {
+                return left.Cost < right.Cost;
+            });
+
+        for (ConditionProgram::Step& step : steps)
+        {
+            program->MaxCost = std::max(program->MaxCost, step.Cost);
+            program->Steps.push_back(std::move(step));
+        }
+        program->GroupEnds.push_back(uint32(program->Steps.size()));
+    }
 
+    return program;
+}
+
+bool ConditionMgr::IsObjectMeetToConditionProgram(ConditionSourceInfo& sourceInfo, ConditionProgram const& program, uint64& checkedConditions) const
+{
+    // the interpreter reported the failure it checked last, keep doing so
+    Condition const* previousFailedCondition = sourceInfo.mLastFailedCondition;
+    Condition const* lastFailedCondition = nullptr;
+    uint32 lastFailedOrder = 0;
+
+    uint32 groupBegin = 0;
+    for (uint32 groupEnd : program.GroupEnds)
+    {
+        bool groupMeets = true;
+        for (uint32 i = groupBegin; i < groupEnd && groupMeets; ++i)
+        {
+            ConditionProgram::Step const& step = program.Steps[i];
+            sourceInfo.mLastFailedCondition = nullptr;
+            if (step.Check)
+            {
+                TC_LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditionProgram {} val1: {}", step.Check->ToString(), step.Check->ConditionValue1);
+                ++checkedConditions;
+                groupMeets = step.Check->Meets(sourceInfo);
             }
-            else //handle normal condition
+            else if (step.Reference)
+                groupMeets = IsObjectMeetToConditionProgram(sourceInfo, *step.Reference, checkedConditions);
+            else
+                groupMeets = false;
+
+            if (sourceInfo.mLastFailedCondition && (!lastFailedCondition || step.Order >= lastFailedOrder))
             {
-                if (!condition->Meets(sourceInfo))
-                    elseGroupStore[condition->ElseGroup] = false;
+                lastFailedCondition = sourceInfo.mLastFailedCondition;
+                lastFailedOrder = step.Order;
             }
         }
-    }
-    for (std::map<uint32, bool>::const_iterator i = elseGroupStore.begin(); i != elseGroupStore.end(); ++i)
-        if (i->second)
+
+        if (groupMeets)
+        {
+            sourceInfo.mLastFailedCondition = lastFailedCondition ? lastFailedCondition : previousFailedCondition;
             return true;
+        }
 
+        groupBegin = groupEnd;
+    }
+
+    sourceInfo.mLastFailedCondition = lastFailedCondition ? lastFailedCondition : previousFailedCondition;
     return false;
 }
 
+bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
+{
+    std::shared_ptr<ConditionProgram const> program = conditions.GetProgram();
+    uint64 checkedConditions = 0;
+    bool meets = IsObjectMeetToConditionProgram(sourceInfo, *program, checkedConditions);
+
+    _evaluatedLists[program->SourceType].fetch_add(1, std::memory_order_relaxed);
+    _checkedConditions[program->SourceType].fetch_add(checkedConditions, std::memory_order_relaxed);
+    return meets;
+}
+
+ConditionMgr::EvaluationCounters ConditionMgr::GetEvaluationCounters(ConditionSourceType sourceType) const
+{
+    EvaluationCounters counters = { };
+    if (sourceType < CONDITION_SOURCE_TYPE_MAX)
+    {
+        counters.Lists = _evaluatedLists[sourceType].load(std::memory_order_relaxed);
+        counters.Conditions = _checkedConditions[sourceType].load(std::memory_order_relaxed);
+    }
+    return counters;
+}
+
 bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionContainer const& conditions) const
 {
     ConditionSourceInfo srcInfo = ConditionSourceInfo(object);
@@ -21,6 +21,8 @@
 #include "Define.h"
 #include "Hash.h"
 #include <array>
+#include <atomic>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -32,6 +34,7 @@ class Unit;
 class WorldObject;
 class LootTemplate;
 struct Condition;
+struct ConditionProgram;
 
 enum ConditionTypes
 {                                                              // value1                 value2         value3
@@ -243,7 +246,33 @@ struct TC_GAME_API Condition
     std::string ToString(bool ext = false) const; /// For logging purpose
 };
 
-typedef std::vector<Condition*> ConditionContainer;
+/*! List of conditions of a single source.
+    The list is compiled into a ConditionProgram on first evaluation, any change drops the compiled program. */
+class TC_GAME_API ConditionContainer
+{
+    public:
+        typedef std::vector<Condition*>::const_iterator const_iterator;
+
+        ConditionContainer();
+        ConditionContainer(ConditionContainer const& right);
+        ConditionContainer& operator=(ConditionContainer const& right);
+        ~ConditionContainer();
+
+        const_iterator begin() const { return _conditions.begin(); }
+        const_iterator end() const { return _conditions.end(); }
+        bool empty() const { return _conditions.empty(); }
+        std::size_t size() const { return _conditions.size(); }
+
+        void push_back(Condition* condition);
+        void clear();
+
+        std::shared_ptr<ConditionProgram const> GetProgram() const;
+
+    private:
+        std::vector<Condition*> _conditions;
+        mutable std::atomic<std::shared_ptr<ConditionProgram const>> _program;
+};
+
 typedef std::unordered_map<uint32 /*SourceEntry*/, ConditionContainer> ConditionsByEntryMap;
 typedef std::array<ConditionsByEntryMap, CONDITION_SOURCE_TYPE_MAX> ConditionEntriesByTypeArray;
 typedef std::unordered_map<uint32, ConditionsByEntryMap> ConditionEntriesByCreatureIdMap;
@@ -279,6 +308,15 @@ class TC_GAME_API ConditionMgr
 
         bool IsSpellUsedInSpellClickConditions(uint32 spellId) const;
 
+        std::shared_ptr<ConditionProgram const> CompileConditions(ConditionContainer const& conditions) const;
+
+        struct EvaluationCounters
+        {
+            uint64 Lists;       // condition lists evaluated
+            uint64 Conditions;  // single conditions checked while doing so
+        };
+        EvaluationCounters GetEvaluationCounters(ConditionSourceType sourceType) const;
+
         struct ConditionTypeInfo
         {
             char const* Name;
@@ -296,6 +334,7 @@ class TC_GAME_API ConditionMgr
         bool addToGossipMenuItems(Condition* cond) const;
         bool addToSpellImplicitTargetConditions(Condition* cond) const;
         bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        bool IsObjectMeetToConditionProgram(ConditionSourceInfo& sourceInfo, ConditionProgram const& program, uint64& checkedConditions) const;
 
         static void LogUselessConditionValue(Condition* cond, uint8 index, uint32 value);
 
@@ -310,6 +349,9 @@ class TC_GAME_API ConditionMgr
         SmartEventConditionContainer    SmartEventConditionStore;
 
         std::unordered_set<uint32> SpellsUsedInSpellClickConditions;
+
+        mutable std::array<std::atomic<uint64>, CONDITION_SOURCE_TYPE_MAX> _evaluatedLists;
+        mutable std::array<std::atomic<uint64>, CONDITION_SOURCE_TYPE_MAX> _checkedConditions;
 };
 
 #define sConditionMgr ConditionMgr::instance()
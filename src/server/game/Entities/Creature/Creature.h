@@ -26,6 +26,7 @@
 #include "Loot.h"
 #include "GridObject.h"
 #include "MapObject.h"
+#include "ObjectPool.h"
 #include <list>
 
 class CreatureAI;
@@ -63,6 +64,8 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
     public:
         explicit Creature(bool isWorldObject = false);
 
+        TC_DECLARE_POOLED_ALLOCATION();
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
@@ -0,0 +1,249 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CreatureUpdateProfiler.h"
+#include "CreatureData.h"
+#include "Metric.h"
+#include "ObjectMgr.h"
+#include "Random.h"
+#include <algorithm>
+
+struct CreatureUpdateProfiler::ThreadStats
+{
+    std::mutex Lock;
+    std::unordered_map<uint32, CreatureUpdateCost> ByEntry;
+    bool InUse = false;
+};
+
+namespace
+{
+    // hands the table of an exiting thread back so the next new thread reuses it
+    struct ThreadStatsHandle
+    {
+        ~ThreadStatsHandle()
+        {
+            if (Stats)
+                sCreatureUpdateProfiler->ReleaseThreadStats(Stats);
+        }
+
+        CreatureUpdateProfiler::ThreadStats* Stats = nullptr;
+    };
+
+    thread_local ThreadStatsHandle CurrentThreadStats;
+    thread_local CreatureUpdateProfiler::SampleScope* CurrentScope = nullptr;
+
+    constexpr std::size_t MetricEntryCount = 10;
+}
+
+void CreatureUpdateCost::Add(CreatureUpdateCost const& other)
+{
+    Samples += other.Samples;
+    EstimatedCalls += other.EstimatedCalls;
+    for (uint8 i = 0; i < MAX_CREATURE_UPDATE_SECTIONS; ++i)
+        Time[i] += other.Time[i];
+    MaxTime = std::max(MaxTime, other.MaxTime);
+}
+
+CreatureUpdateProfiler::SampleScope::SampleScope(uint32 entry) : _previous(nullptr), _sampleRate(sCreatureUpdateProfiler->GetSampleRate())
+{
+    if (!_sampleRate)
+        return;
+
+    // an update that is not picked must not add its sections to an enclosing one
+    _previous = std::exchange(CurrentScope, nullptr);
+    if (_sampleRate > 1 && rand32() % _sampleRate)
+        return;
+
+    _cost.Entry = entry;
+    _cost.Samples = 1;
+    CurrentScope = this;
+    _start = std::chrono::steady_clock::now();
+}
+
+CreatureUpdateProfiler::SampleScope::~SampleScope()
+{
+    if (!_sampleRate)
+        return;
+
+    CurrentScope = _previous;
+    if (!_cost.Samples)
+        return;
+
+    uint64 elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+    _cost.Time[CREATURE_UPDATE_SECTION_TOTAL] = elapsed;
+    _cost.MaxTime = elapsed;
+    _cost.EstimatedCalls = _sampleRate;
+    for (uint64& time : _cost.Time)
+        time *= _sampleRate;
+
+    sCreatureUpdateProfiler->Record(_cost);
+}
+
+CreatureUpdateProfiler::SectionTimer::SectionTimer(CreatureUpdateSection section) : _scope(CurrentScope), _section(section)
+{
+    if (_scope)
+        _start = std::chrono::steady_clock::now();
+}
+
+CreatureUpdateProfiler::SectionTimer::~SectionTimer()
+{
+    if (_scope)
+        _scope->_cost.Time[_section] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+}
+
+CreatureUpdateProfiler::CreatureUpdateProfiler() : _sampleRate(0) { }
+
+CreatureUpdateProfiler::~CreatureUpdateProfiler() = default;
+
+CreatureUpdateProfiler* CreatureUpdateProfiler::instance()
+{
+    static CreatureUpdateProfiler instance;
+    return &instance;
+}
+
+CreatureUpdateProfiler::ThreadStats& CreatureUpdateProfiler::GetThreadStats()
+{
+    if (CurrentThreadStats.Stats)
+        return *CurrentThreadStats.Stats;
+
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    auto itr = std::find_if(_threads.begin(), _threads.end(), [](std::unique_ptr<ThreadStats> const& stats) { return !stats->InUse; });
+    if (itr == _threads.end())
+    {
+        _threads.push_back(std::make_unique<ThreadStats>());
+        itr = std::prev(_threads.end());
+    }
+
+    (*itr)->InUse = true;
+    CurrentThreadStats.Stats = itr->get();
+    return **itr;
+}
+
+void CreatureUpdateProfiler::ReleaseThreadStats(ThreadStats* stats)
+{
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    stats->InUse = false;
+}
+
+void CreatureUpdateProfiler::Record(CreatureUpdateCost const& cost)
+{
+    ThreadStats& stats = GetThreadStats();
+    std::lock_guard<std::mutex> lock(stats.Lock);
+    CreatureUpdateCost& total = stats.ByEntry[cost.Entry];
+    total.Entry = cost.Entry;
+    total.Add(cost);
+}
+
+void CreatureUpdateProfiler::Reset()
+{
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    for (std::unique_ptr<ThreadStats> const& stats : _threads)
+    {
+        std::lock_guard<std::mutex> statsLock(stats->Lock);
+        stats->ByEntry.clear();
+    }
+
+    _exported.clear();
+}
+
+std::unordered_map<uint32, CreatureUpdateCost> CreatureUpdateProfiler::Aggregate() const
+{
+    std::unordered_map<uint32, CreatureUpdateCost> totals;
+    for (std::unique_ptr<ThreadStats> const& stats : _threads)
+    {
+        std::lock_guard<std::mutex> statsLock(stats->Lock);
+        for (auto const& [entry, cost] : stats->ByEntry)
+        {
+            CreatureUpdateCost& total = totals[entry];
+            total.Entry = entry;
+            total.Add(cost);
+        }
+    }
+
+    return totals;
+}
+
+std::vector<CreatureUpdateCost> CreatureUpdateProfiler::GetStatistics() const
+{
+    std::unordered_map<uint32, CreatureUpdateCost> totals;
+    {
+        std::lock_guard<std::mutex> lock(_threadsLock);
+        totals = Aggregate();
+    }
+
+    std::vector<CreatureUpdateCost> statistics;
+    statistics.reserve(totals.size());
+    for (auto const& [entry, cost] : totals)
+        statistics.push_back(cost);
+
+    std::sort(statistics.begin(), statistics.end(), [](CreatureUpdateCost const& left, CreatureUpdateCost const& right)
+    {
+        return left.Time[CREATURE_UPDATE_SECTION_TOTAL] > right.Time[CREATURE_UPDATE_SECTION_TOTAL];
+    });
+    return statistics;
+}
+
+void CreatureUpdateProfiler::LogMetrics()
+{
+    if (!GetSampleRate())
+        return;
+
+    std::unordered_map<uint32, CreatureUpdateCost> current;
+    std::unordered_map<uint32, CreatureUpdateCost> previous;
+    {
+        std::lock_guard<std::mutex> lock(_threadsLock);
+        current = Aggregate();
+        previous = std::exchange(_exported, current);
+    }
+
+    // (entry, time spent since the previous export)
+    std::vector<std::pair<uint32, uint64>> costs;
+    for (auto const& [entry, cost] : current)
+    {
+        uint64 time = cost.Time[CREATURE_UPDATE_SECTION_TOTAL];
+        auto itr = previous.find(entry);
+        if (itr != previous.end())
+            time -= itr->second.Time[CREATURE_UPDATE_SECTION_TOTAL];
+
+        if (time)
+            costs.emplace_back(entry, time);
+    }
+
+    std::size_t count = std::min(costs.size(), MetricEntryCount);
+    std::partial_sort(costs.begin(), costs.begin() + count, costs.end(), [](std::pair<uint32, uint64> const& left, std::pair<uint32, uint64> const& right)
+    {
+        return left.second > right.second;
+    });
+
+    for (std::size_t i = 0; i < count; ++i)
+        TC_METRIC_VALUE("creature_update_time", costs[i].second / 1000, TC_METRIC_TAG("entry", std::to_string(costs[i].first)), TC_METRIC_TAG("script", GetScriptName(costs[i].first)));
+}
+
+std::string CreatureUpdateProfiler::GetScriptName(uint32 entry)
+{
+    CreatureTemplate const* creatureTemplate = sObjectMgr->GetCreatureTemplate(entry);
+    if (!creatureTemplate)
+        return "unknown";
+
+    if (creatureTemplate->ScriptID)
+        return sObjectMgr->GetScriptName(creatureTemplate->ScriptID);
+
+    if (!creatureTemplate->AIName.empty())
+        return creatureTemplate->AIName;
+
+    return "default";
+}
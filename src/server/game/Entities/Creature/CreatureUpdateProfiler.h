@@ -0,0 +1,137 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_CREATUREUPDATEPROFILER_H
+#define TRINITY_CREATUREUPDATEPROFILER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum CreatureUpdateSection : uint8
+{
+    CREATURE_UPDATE_SECTION_TOTAL,          // Creature::Update
+    CREATURE_UPDATE_SECTION_AI,             // CreatureAI::UpdateAI
+    CREATURE_UPDATE_SECTION_MOTION,         // MotionMaster::Update
+    CREATURE_UPDATE_SECTION_SMARTSCRIPT,    // SmartScript::OnUpdate, part of the AI time
+
+    MAX_CREATURE_UPDATE_SECTIONS
+};
+
+struct CreatureUpdateCost
+{
+    uint32 Entry = 0;
+    uint64 Samples = 0;
+    uint64 EstimatedCalls = 0;                                  // samples times the sample rate
+    std::array<uint64, MAX_CREATURE_UPDATE_SECTIONS> Time = { }; // nanoseconds, scaled by the sample rate
+    uint64 MaxTime = 0;                                         // nanoseconds, longest sampled Creature::Update
+
+    void Add(CreatureUpdateCost const& other);
+};
+
+/*
+ * Measures where creature updates spend map thread time, keyed by creature entry.
+ * One of every SampleRate calls of Creature::Update is measured at random, including the AI, movement
+ * and SmartScript sections running inside it, and the times are scaled up by the rate.
+ * Every map thread collects into its own table, which only it writes while a report or reset is not reading it.
+ */
+class TC_GAME_API CreatureUpdateProfiler
+{
+    private:
+        CreatureUpdateProfiler();
+        ~CreatureUpdateProfiler();
+
+    public:
+        struct ThreadStats;
+        class SectionTimer;
+
+        // Measures one Creature::Update call if it is picked, and the sections nested in it
+        class SampleScope
+        {
+            public:
+                explicit SampleScope(uint32 entry);
+                ~SampleScope();
+
+                SampleScope(SampleScope const&) = delete;
+                SampleScope& operator=(SampleScope const&) = delete;
+
+            private:
+                friend class SectionTimer;
+
+                CreatureUpdateCost _cost;
+                SampleScope* _previous;
+                TimePoint _start;
+                uint32 _sampleRate;
+        };
+
+        // Adds its lifetime to a section when it runs inside a measured Creature::Update, otherwise does nothing
+        class SectionTimer
+        {
+            public:
+                explicit SectionTimer(CreatureUpdateSection section);
+                ~SectionTimer();
+
+                SectionTimer(SectionTimer const&) = delete;
+                SectionTimer& operator=(SectionTimer const&) = delete;
+
+            private:
+                SampleScope* _scope;
+                TimePoint _start;
+                CreatureUpdateSection _section;
+        };
+
+        static CreatureUpdateProfiler* instance();
+
+        // 0 disables the profiler
+        uint32 GetSampleRate() const { return _sampleRate.load(std::memory_order_relaxed); }
+        void SetSampleRate(uint32 sampleRate) { _sampleRate.store(sampleRate, std::memory_order_relaxed); }
+
+        void Reset();
+
+        // Costs since the last reset, highest total time first
+        std::vector<CreatureUpdateCost> GetStatistics() const;
+
+        // Sends the entries that took the most time since the previous call to the metric database
+        void LogMetrics();
+
+        // ScriptName of the creature template, or its AIName when it has no script
+        static std::string GetScriptName(uint32 entry);
+
+        // Called when a thread exits, its table is kept and handed to the next new thread
+        void ReleaseThreadStats(ThreadStats* stats);
+
+    private:
+        void Record(CreatureUpdateCost const& cost);
+        ThreadStats& GetThreadStats();
+        std::unordered_map<uint32, CreatureUpdateCost> Aggregate() const;
+
+        std::atomic<uint32> _sampleRate;
+
+        mutable std::mutex _threadsLock;
+        std::vector<std::unique_ptr<ThreadStats>> _threads;
+        std::unordered_map<uint32, CreatureUpdateCost> _exported;
+};
+
+#define sCreatureUpdateProfiler CreatureUpdateProfiler::instance()
+
+#endif
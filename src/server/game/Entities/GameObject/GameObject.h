@@ -23,6 +23,7 @@
 #include "GameObjectData.h"
 #include "Loot.h"
 #include "MapObject.h"
+#include "ObjectPool.h"
 #include "SharedDefines.h"
 
 class GameObjectAI;
@@ -88,6 +89,8 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         explicit GameObject();
         ~GameObject();
 
+        TC_DECLARE_POOLED_ALLOCATION();
+
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const override;
 
         void AddToWorld() override;
@@ -136,6 +139,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
                 ABORT();
             }
             m_spawnedByDefault = false;                     // all object with owner is despawned after delay
+            UpdateModelSpawnState();
             SetGuidValue(OBJECT_FIELD_CREATED_BY, owner);
         }
         ObjectGuid GetOwnerGUID() const override { return GetGuidValue(OBJECT_FIELD_CREATED_BY); }
@@ -143,6 +147,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         void SetSpellId(uint32 id)
         {
             m_spawnedByDefault = false;                     // all summoned object is despawned after delay
+            UpdateModelSpawnState();
             m_spellId = id;
         }
         uint32 GetSpellId() const { return m_spellId;}
@@ -159,7 +164,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
                 (m_respawnTime == 0 && m_spawnedByDefault);
         }
         bool isSpawnedByDefault() const { return m_spawnedByDefault; }
-        void SetSpawnedByDefault(bool b) { m_spawnedByDefault = b; }
+        void SetSpawnedByDefault(bool b) { m_spawnedByDefault = b; UpdateModelSpawnState(); }
         uint32 GetRespawnDelay() const { return m_respawnDelayTime; }
         void Refresh();
         void DespawnOrUnsummon(Milliseconds delay = 0ms, Seconds forceRespawnTime = 0s);
@@ -317,6 +322,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
     protected:
         void CreateModel();
         void UpdateModel();                                 // updates model in case displayId were changed
+        void UpdateModelSpawnState();                       // must follow every change of isSpawned(), collision ignores despawned objects
         uint32      m_spellId;
         time_t      m_respawnTime;                          // (secs) time of next respawn (or despawn if GO have owner()),
         uint32      m_respawnDelayTime;                     // (secs) if 0 then current GO state no dependent from timer
@@ -325,6 +331,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         LootState   m_lootState;
         ObjectGuid  m_lootStateUnitGUID;                    // GUID of the unit passed with SetLootState(LootState, Unit*)
         bool        m_spawnedByDefault;
+        bool        m_modelSpawned;                         // isSpawned() as last seen by cached collision queries
         time_t      m_restockTime;
         time_t      m_cooldownTime;                         // used as internal reaction delay time store (not state change reaction).
                                                             // For traps this: spell casting cooldown, for doors/buttons: reset time.
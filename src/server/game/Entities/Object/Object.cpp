@@ -457,15 +457,9 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player const*
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
     ASSERT(flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-    {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-        }
-    }
+    BuildValuesUpdateMask(updateType, flags, visibleFlag, _fieldNotifyFlags, updateMask);
+    for (uint32 index = updateMask.FindNextSetBit(0); index < m_valuesCount; index = updateMask.FindNextSetBit(index + 1))
+        fieldBuffer << m_uint32Values[index];
 
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
@@ -549,6 +543,32 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
     return visibleFlag;
 }
 
+void Object::BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 forcedFlags, UpdateMaskPacketBuilder& updateMask) const
+{
+    constexpr uint32 MaxBlocks = UpdateFieldFlagMasks::MAX_BLOCKS;
+    uint32 blockCount = UpdateMask::GetBlockCount(m_valuesCount);
+    ASSERT(blockCount <= MaxBlocks);
+
+    UpdateFieldFlagMasks const& flagMasks = UpdateFieldFlagMasks::Get(flags);
+    std::array<UpdateMask::BlockType, MaxBlocks> visible = { };
+    std::array<UpdateMask::BlockType, MaxBlocks> forced = { };
+    flagMasks.Collect(visibleFlag, visible.data(), blockCount);
+    flagMasks.Collect(forcedFlags, forced.data(), blockCount);
+
+    UpdateMask::BlockType const* changed = _changesMask.GetBlocks();
+    std::array<UpdateMask::BlockType, MaxBlocks> nonZero = { };
+    if (updateType != UPDATETYPE_VALUES)
+    {
+        // object creation sends every field that has a value
+        for (uint32 index = 0; index < m_valuesCount; ++index)
+            nonZero[index / UpdateMask::BLOCK_BITS] |= UpdateMask::BlockType(m_uint32Values[index] != 0) << (index % UpdateMask::BLOCK_BITS);
+
+        changed = nonZero.data();
+    }
+
+    updateMask.SetBlocks(changed, visible.data(), forced.data(), m_valuesCount);
+}
+
 bool Object::_LoadIntoDataField(std::string const& data, uint32 startOffset, uint32 count)
 {
     if (data.empty())
@@ -1198,21 +1218,32 @@ Position WorldObject::GetHitSpherePointFor(Position const& dest) const
 
 bool WorldObject::IsWithinLOS(float ox, float oy, float oz, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
-    if (IsInWorld())
-    {
-        oz += GetCollisionHeight();
-        float x, y, z;
-        if (GetTypeId() == TYPEID_PLAYER)
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
+    VMAP::LineOfSightQuery query;
+    if (!BuildLineOfSightQuery(ox, oy, oz, query))
+        return true;
+
+    return GetMap()->isInLineOfSight(query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2, query.PhaseMask, checks, ignoreFlags);
+}
 
-        return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+bool WorldObject::BuildLineOfSightQuery(float ox, float oy, float oz, VMAP::LineOfSightQuery& query) const
+{
+    if (!IsInWorld())
+        return false;
+
+    oz += GetCollisionHeight();
+    if (GetTypeId() == TYPEID_PLAYER)
+    {
+        GetPosition(query.X1, query.Y1, query.Z1);
+        query.Z1 += GetCollisionHeight();
     }
+    else
+        GetHitSpherePointFor({ ox, oy, oz }, query.X1, query.Y1, query.Z1);
 
+    query.X2 = ox;
+    query.Y2 = oy;
+    query.Z2 = oz;
+    query.PhaseMask = GetPhaseMask();
+    query.InLineOfSight = true;
     return true;
 }
 
@@ -16,6 +16,7 @@
  */
 
 #include "UpdateFieldFlags.h"
+#include "Errors.h"
 
 uint32 ItemUpdateFieldFlags[CONTAINER_END] =
 {
@@ -1566,3 +1567,47 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+UpdateFieldFlagMasks::UpdateFieldFlagMasks(uint32 const* flags, uint32 fieldCount) : _rows()
+{
+    ASSERT(fieldCount <= MAX_BLOCKS * 32);
+    for (uint32 index = 0; index < fieldCount; ++index)
+        for (uint32 flag = 0; flag < FLAG_COUNT; ++flag)
+            if (flags[index] & (1u << flag))
+                _rows[flag][index / 32] |= 1u << (index % 32);
+}
+
+void UpdateFieldFlagMasks::Collect(uint32 flagMask, uint32* blocks, uint32 blockCount) const
+{
+    for (uint32 flag = 0; flag < FLAG_COUNT; ++flag)
+    {
+        if (!(flagMask & (1u << flag)))
+            continue;
+
+        // plain loop over whole rows, compiles to SSE/AVX ORs
+        uint32 const* row = _rows[flag].data();
+        for (uint32 block = 0; block < blockCount; ++block)
+            blocks[block] |= row[block];
+    }
+}
+
+UpdateFieldFlagMasks const& UpdateFieldFlagMasks::Get(uint32 const* flags)
+{
+    static UpdateFieldFlagMasks const itemMasks(ItemUpdateFieldFlags, CONTAINER_END);
+    static UpdateFieldFlagMasks const unitMasks(UnitUpdateFieldFlags, PLAYER_END);
+    static UpdateFieldFlagMasks const gameObjectMasks(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+    static UpdateFieldFlagMasks const dynamicObjectMasks(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+    static UpdateFieldFlagMasks const corpseMasks(CorpseUpdateFieldFlags, CORPSE_END);
+
+    if (flags == ItemUpdateFieldFlags)
+        return itemMasks;
+    if (flags == UnitUpdateFieldFlags)
+        return unitMasks;
+    if (flags == GameObjectUpdateFieldFlags)
+        return gameObjectMasks;
+    if (flags == DynamicObjectUpdateFieldFlags)
+        return dynamicObjectMasks;
+
+    ASSERT(flags == CorpseUpdateFieldFlags);
+    return corpseMasks;
+}
@@ -20,6 +20,7 @@
 
 #include "UpdateFields.h"
 #include "Define.h"
+#include <array>
 
 enum UpdatefieldFlags
 {
@@ -41,4 +42,22 @@ TC_GAME_API extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 TC_GAME_API extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 TC_GAME_API extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+// One bit-packed row of fields per UpdatefieldFlags bit, lets value update builders select fields 32 at a time
+class TC_GAME_API UpdateFieldFlagMasks
+{
+public:
+    static constexpr uint32 FLAG_COUNT = 9;
+    static constexpr uint32 MAX_BLOCKS = (PLAYER_END + 31) / 32;
+
+    UpdateFieldFlagMasks(uint32 const* flags, uint32 fieldCount);
+
+    // ORs the rows of every flag in flagMask into blocks
+    void Collect(uint32 flagMask, uint32* blocks, uint32 blockCount) const;
+
+    static UpdateFieldFlagMasks const& Get(uint32 const* flags);
+
+private:
+    std::array<std::array<uint32, MAX_BLOCKS>, FLAG_COUNT> _rows;
+};
+
 #endif // _UPDATEFIELDFLAGS_H
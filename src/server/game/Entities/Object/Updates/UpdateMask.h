@@ -21,42 +21,58 @@
 #include "UpdateFields.h"
 #include "ByteBuffer.h"
 #include "Errors.h"
+#include <algorithm>
+#include <bit>
 
 class UpdateMask
 {
 public:
-    UpdateMask() : _bits(nullptr), _fieldCount(0) { }
+    /// Fields are packed 32 per block, same layout as the mask sent to the client
+    using BlockType = uint32;
+
+    enum UpdateMaskCount
+    {
+        BLOCK_BITS = sizeof(BlockType) * 8,
+    };
+
+    UpdateMask() : _blocks(nullptr), _fieldCount(0) { }
 
     void SetBit(uint32 index)
     {
-        _bits[index] = 1;
+        _blocks[index / BLOCK_BITS] |= BlockType(1) << (index % BLOCK_BITS);
     }
 
     void UnsetBit(uint32 index)
     {
-        _bits[index] = 0;
+        _blocks[index / BLOCK_BITS] &= ~(BlockType(1) << (index % BLOCK_BITS));
     }
 
     bool GetBit(uint32 index) const
     {
-        return _bits[index] != 0;
+        return (_blocks[index / BLOCK_BITS] & (BlockType(1) << (index % BLOCK_BITS))) != 0;
     }
 
     void SetCount(uint32 valuesCount)
     {
-        _bits = std::make_unique<uint8[]>(valuesCount);
-        std::uninitialized_fill_n(&_bits[0], valuesCount, 0);
+        _blocks = std::make_unique<BlockType[]>(GetBlockCount(valuesCount));
         _fieldCount = valuesCount;
     }
 
     void Clear()
     {
-        if (_bits)
-            std::fill_n(&_bits[0], _fieldCount, 0);
+        if (_blocks)
+            std::fill_n(&_blocks[0], GetBlockCount(_fieldCount), 0);
+    }
+
+    BlockType const* GetBlocks() const { return _blocks.get(); }
+
+    static constexpr uint32 GetBlockCount(uint32 fieldCount)
+    {
+        return (fieldCount + BLOCK_BITS - 1) / BLOCK_BITS;
     }
 
 private:
-    std::unique_ptr<uint8[]> _bits;
+    std::unique_ptr<BlockType[]> _blocks;
     uint32 _fieldCount;
 };
 
@@ -64,24 +80,62 @@ class UpdateMaskPacketBuilder
 {
 public:
     /// Type representing how client reads update mask
-    using ClientUpdateMaskType = uint32;
+    using ClientUpdateMaskType = UpdateMask::BlockType;
 
     enum UpdateMaskCount
     {
         CLIENT_UPDATE_MASK_BITS = sizeof(ClientUpdateMaskType) * 8,
     };
 
-    explicit UpdateMaskPacketBuilder(uint32 valuesCount) : _lastSetBit(0)
+    explicit UpdateMaskPacketBuilder(uint32 valuesCount) : _blockCount(CalculateBlockCount(valuesCount)), _lastSetBit(0)
     {
-        std::size_t blockCount = CalculateBlockCount(valuesCount);
-        _mask = std::make_unique<ClientUpdateMaskType[]>(blockCount);
-        std::uninitialized_fill_n(&_mask[0], blockCount, 0);
+        _mask = std::make_unique<ClientUpdateMaskType[]>(_blockCount);
     }
 
     void SetBit(uint32 bit)
     {
         _mask[GetBlockIndex(bit)] |= GetBlockFlag(bit);
-        _lastSetBit = bit;
+        _lastSetBit = std::max(_lastSetBit, bit);
+    }
+
+    /// Selects the first fieldCount fields a whole block at a time: (changed & visible) | forced
+    void SetBlocks(ClientUpdateMaskType const* changed, ClientUpdateMaskType const* visible, ClientUpdateMaskType const* forced, uint32 fieldCount)
+    {
+        std::size_t blockCount = CalculateBlockCount(fieldCount);
+        for (std::size_t block = 0; block < blockCount; ++block)
+            _mask[block] |= (changed[block] & visible[block]) | forced[block];
+
+        // drop flag bits of fields past the end of this object (creatures use the player sized unit table)
+        if (uint32 tailBits = fieldCount % CLIENT_UPDATE_MASK_BITS)
+            _mask[blockCount - 1] &= (ClientUpdateMaskType(1) << tailBits) - 1;
+
+        for (std::size_t block = blockCount; block > 0; --block)
+        {
+            if (ClientUpdateMaskType bits = _mask[block - 1])
+            {
+                _lastSetBit = std::max<uint32>(_lastSetBit, (block - 1) * CLIENT_UPDATE_MASK_BITS + std::bit_width(bits) - 1);
+                break;
+            }
+        }
+    }
+
+    /// Index of the first selected field at or after bit, or a value past the last block if there is none
+    uint32 FindNextSetBit(uint32 bit) const
+    {
+        std::size_t block = GetBlockIndex(bit);
+        if (block >= _blockCount)
+            return _blockCount * CLIENT_UPDATE_MASK_BITS;
+
+        ClientUpdateMaskType bits = _mask[block] & ~(GetBlockFlag(bit) - 1);
+        while (!bits)
+        {
+            if (++block >= _blockCount)
+                return _blockCount * CLIENT_UPDATE_MASK_BITS;
+
+            bits = _mask[block];
+        }
+
+        return block * CLIENT_UPDATE_MASK_BITS + std::countr_zero(bits);
     }
 
     void AppendToPacket(ByteBuffer* data)
@@ -109,6 +163,7 @@ private:
     }
 
     std::unique_ptr<ClientUpdateMaskType[]> _mask;
+    std::size_t _blockCount;
     uint32 _lastSetBit;
 };
 
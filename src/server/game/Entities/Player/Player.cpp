@@ -174,6 +174,10 @@ static uint32 corpseReclaimDelay[MAX_DEATH_COUNT] = { 30, 60, 120 };
 
 uint32 const MAX_MONEY_AMOUNT = static_cast<uint32>(std::numeric_limits<int32>::max());
 
+// players are saved from all map threads
+static std::atomic<uint64> PlayerSaveCount;
+static std::array<std::atomic<uint64>, MAX_PLAYER_SAVE_SECTIONS> PlayerSaveStatementCounts;
+
 Player::Player(WorldSession* session): Unit(true)
 {
     m_objectType |= TYPEMASK_PLAYER;
@@ -209,6 +213,7 @@ Player::Player(WorldSession* session): Unit(true)
     m_needsZoneUpdate = false;
 
     m_nextSave = sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
+    m_savedAurasValid = false;
 
     memset(m_items, 0, sizeof(Item*)*PLAYER_SLOTS_COUNT);
 
@@ -19150,6 +19155,15 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create /* = false
     if (!create)
         sScriptMgr->OnPlayerSave(this);
 
+    // statements queued by every part of the save, the transaction may already hold other statements
+    std::array<std::size_t, MAX_PLAYER_SAVE_SECTIONS> statements = { };
+    std::size_t sectionStart = trans->GetSize();
+    auto endSection = [&](PlayerSaveSection section)
+    {
+        statements[section] += trans->GetSize() - sectionStart;
+        sectionStart = trans->GetSize();
+    };
+
     CharacterDatabasePreparedStatement* stmt = nullptr;
     uint8 index = 0;
 
@@ -19412,34 +19426,57 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create /* = false
         stmt->setUInt32(index++, m_fishingSteps);
         trans->Append(stmt);
     }
+    endSection(PLAYER_SAVE_SECTION_CHARACTER);
 
     if (m_mailsUpdated)                                     //save mails only when needed
         _SaveMail(trans);
 
     _SaveBGData(trans);
+    endSection(PLAYER_SAVE_SECTION_OTHER);
     _SaveInventory(trans);
+    endSection(PLAYER_SAVE_SECTION_INVENTORY);
     _SaveQuestStatus(trans);
     _SaveDailyQuestStatus(trans);
     _SaveWeeklyQuestStatus(trans);
     _SaveSeasonalQuestStatus(trans);
     _SaveMonthlyQuestStatus(trans);
+    endSection(PLAYER_SAVE_SECTION_QUESTS);
     _SaveTalents(trans);
     _SaveSpells(trans);
     GetSpellHistory()->SaveToDB<Player>(trans);
+    endSection(PLAYER_SAVE_SECTION_SPELLS);
     _SaveActions(trans);
+    endSection(PLAYER_SAVE_SECTION_ACTIONS);
     _SaveAuras(trans);
+    endSection(PLAYER_SAVE_SECTION_AURAS);
     _SaveSkills(trans);
+    endSection(PLAYER_SAVE_SECTION_SKILLS);
     m_achievementMgr->SaveToDB(trans);
+    endSection(PLAYER_SAVE_SECTION_ACHIEVEMENTS);
     m_reputationMgr->SaveToDB(trans);
+    endSection(PLAYER_SAVE_SECTION_REPUTATION);
     _SaveEquipmentSets(trans);
     GetSession()->SaveTutorialsData(trans);                 // changed only while character in game
     _SaveGlyphs(trans);
     GetSession()->SaveInstanceTimeRestrictions(trans);
+    endSection(PLAYER_SAVE_SECTION_OTHER);
 
     // check if stats should only be saved on logout
     // save stats can be out of transaction
     if (m_session->isLogingOut() || !sWorld->getBoolConfig(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT))
         _SaveStats(trans);
+    endSection(PLAYER_SAVE_SECTION_STATS);
+
+    std::size_t totalStatements = 0;
+    for (uint8 i = 0; i < MAX_PLAYER_SAVE_SECTIONS; ++i)
+    {
+        PlayerSaveStatementCounts[i].fetch_add(statements[i], std::memory_order_relaxed);
+        totalStatements += statements[i];
+    }
+    PlayerSaveCount.fetch_add(1, std::memory_order_relaxed);
+
+    TC_LOG_DEBUG("entities.player", "Player::SaveToDB: {} queued {} statements ({} for auras, {} for inventory)",
+        GetGUID().ToString(), totalStatements, statements[PLAYER_SAVE_SECTION_AURAS], statements[PLAYER_SAVE_SECTION_INVENTORY]);
 
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
@@ -19453,6 +19490,15 @@ void Player::SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans)
     SaveGoldToDB(trans);
 }
 
+PlayerSaveStatistics Player::GetSaveStatistics()
+{
+    PlayerSaveStatistics statistics;
+    statistics.Saves = PlayerSaveCount.load(std::memory_order_relaxed);
+    for (uint8 i = 0; i < MAX_PLAYER_SAVE_SECTIONS; ++i)
+        statistics.Statements[i] = PlayerSaveStatementCounts[i].load(std::memory_order_relaxed);
+    return statistics;
+}
+
 void Player::SaveGoldToDB(CharacterDatabaseTransaction trans) const
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_MONEY);
@@ -19511,10 +19557,7 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->setUInt32(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
+    std::map<SavedAuraKey, SavedAuraData> auras;
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
         if (!itr->second->CanBeSaved())
@@ -19522,49 +19565,97 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans)
 
         Aura* aura = itr->second;
 
-        int32 damage[MAX_SPELL_EFFECTS];
-        int32 baseDamage[MAX_SPELL_EFFECTS];
-        uint8 effMask = 0;
-        uint8 recalculateMask = 0;
+        SavedAuraKey key;
+        key.CasterGuid = aura->GetCasterGUID();
+        key.ItemGuid = aura->GetCastItemGUID();
+        key.SpellId = aura->GetId();
+        key.EffectMask = 0;
+
+        SavedAuraData data;
+        data.RecalculateMask = 0;
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
             if (AuraEffect const* effect = aura->GetEffect(i))
             {
-                baseDamage[i] = effect->GetBaseAmount();
-                damage[i] = effect->GetAmount();
-                effMask |= 1 << i;
+                data.BaseAmount[i] = effect->GetBaseAmount();
+                data.Amount[i] = effect->GetAmount();
+                key.EffectMask |= 1 << i;
                 if (effect->CanBeRecalculated())
-                    recalculateMask |= 1 << i;
+                    data.RecalculateMask |= 1 << i;
             }
             else
             {
-                baseDamage[i] = 0;
-                damage[i] = 0;
+                data.BaseAmount[i] = 0;
+                data.Amount[i] = 0;
             }
         }
 
+        data.StackAmount = aura->GetStackAmount();
+        data.MaxDuration = aura->GetMaxDuration();
+        data.Duration = aura->GetDuration();
+        data.Charges = aura->GetCharges();
+        data.CritChance = aura->GetCritChance();
+        data.ApplyResilience = aura->CanApplyResilience();
+        auras.emplace(key, data);
+    }
+
+    CharacterDatabasePreparedStatement* stmt;
+    if (!m_savedAurasValid)
+    {
+        // rows loaded at login may not match any aura anymore
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+        stmt->setUInt32(0, GetGUID().GetCounter());
+        trans->Append(stmt);
+        m_savedAuras.clear();
+        m_savedAurasValid = true;
+    }
+
+    for (std::pair<SavedAuraKey const, SavedAuraData> const& savedAura : m_savedAuras)
+    {
+        if (auras.count(savedAura.first))
+            continue;
+
+        uint8 index = 0;
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_BY_KEY);
+        stmt->setUInt32(index++, GetGUID().GetCounter());
+        stmt->setUInt64(index++, savedAura.first.CasterGuid.GetRawValue());
+        stmt->setUInt64(index++, savedAura.first.ItemGuid.GetRawValue());
+        stmt->setUInt32(index++, savedAura.first.SpellId);
+        stmt->setUInt8(index++, savedAura.first.EffectMask);
+        trans->Append(stmt);
+    }
+
+    for (std::pair<SavedAuraKey const, SavedAuraData> const& aura : auras)
+    {
+        auto saved = m_savedAuras.find(aura.first);
+        if (saved != m_savedAuras.end() && saved->second == aura.second)
+            continue;
+
+        SavedAuraData const& data = aura.second;
         uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_AURA);
         stmt->setUInt32(index++, GetGUID().GetCounter());
-        stmt->setUInt64(index++, itr->second->GetCasterGUID().GetRawValue());
-        stmt->setUInt64(index++, itr->second->GetCastItemGUID().GetRawValue());
-        stmt->setUInt32(index++, itr->second->GetId());
-        stmt->setUInt8(index++, effMask);
-        stmt->setUInt8(index++, recalculateMask);
-        stmt->setUInt8(index++, itr->second->GetStackAmount());
-        stmt->setInt32(index++, damage[0]);
-        stmt->setInt32(index++, damage[1]);
-        stmt->setInt32(index++, damage[2]);
-        stmt->setInt32(index++, baseDamage[0]);
-        stmt->setInt32(index++, baseDamage[1]);
-        stmt->setInt32(index++, baseDamage[2]);
-        stmt->setInt32(index++, itr->second->GetMaxDuration());
-        stmt->setInt32(index++, itr->second->GetDuration());
-        stmt->setUInt8(index++, itr->second->GetCharges());
-        stmt->setFloat(index++, itr->second->GetCritChance());
-        stmt->setBool (index++, itr->second->CanApplyResilience());
+        stmt->setUInt64(index++, aura.first.CasterGuid.GetRawValue());
+        stmt->setUInt64(index++, aura.first.ItemGuid.GetRawValue());
+        stmt->setUInt32(index++, aura.first.SpellId);
+        stmt->setUInt8(index++, aura.first.EffectMask);
+        stmt->setUInt8(index++, data.RecalculateMask);
+        stmt->setUInt8(index++, data.StackAmount);
+        stmt->setInt32(index++, data.Amount[0]);
+        stmt->setInt32(index++, data.Amount[1]);
+        stmt->setInt32(index++, data.Amount[2]);
+        stmt->setInt32(index++, data.BaseAmount[0]);
+        stmt->setInt32(index++, data.BaseAmount[1]);
+        stmt->setInt32(index++, data.BaseAmount[2]);
+        stmt->setInt32(index++, data.MaxDuration);
+        stmt->setInt32(index++, data.Duration);
+        stmt->setUInt8(index++, data.Charges);
+        stmt->setFloat(index++, data.CritChance);
+        stmt->setBool (index++, data.ApplyResilience);
         trans->Append(stmt);
     }
+
+    m_savedAuras = std::move(auras);
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction trans)
@@ -20068,51 +20159,70 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 
 // save player stats -- only for external usage
 // real stats will be recalculated on player login
-void Player::_SaveStats(CharacterDatabaseTransaction trans) const
+void Player::_SaveStats(CharacterDatabaseTransaction trans)
 {
     // check if stat saving is enabled and if char level is high enough
     if (!sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE) || GetLevel() < sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE))
         return;
 
-    CharacterDatabasePreparedStatement* stmt;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
-    stmt->setUInt32(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
-    uint8 index = 0;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
-    stmt->setUInt32(index++, GetGUID().GetCounter());
-    stmt->setUInt32(index++, GetMaxHealth());
+    SavedStatsData stats;
+    stats.MaxHealth = GetMaxHealth();
 
     for (uint8 i = 0; i < MAX_POWERS; ++i)
-        stmt->setUInt32(index++, GetMaxPower(Powers(i)));
+        stats.MaxPower[i] = GetMaxPower(Powers(i));
 
     for (uint8 i = 0; i < MAX_STATS; ++i)
-        stmt->setUInt32(index++, GetStat(Stats(i)));
+        stats.Stat[i] = GetStat(Stats(i));
 
     for (int i = 0; i < MAX_SPELL_SCHOOL; ++i)
-        stmt->setUInt32(index++, GetResistance(SpellSchools(i)));
+        stats.Resistance[i] = GetResistance(SpellSchools(i));
 
-    stmt->setFloat(index++, GetFloatValue(PLAYER_BLOCK_PERCENTAGE));
-    stmt->setFloat(index++, GetFloatValue(PLAYER_DODGE_PERCENTAGE));
-    stmt->setFloat(index++, GetFloatValue(PLAYER_PARRY_PERCENTAGE));
-    stmt->setFloat(index++, GetFloatValue(PLAYER_CRIT_PERCENTAGE));
-    stmt->setFloat(index++, GetFloatValue(PLAYER_RANGED_CRIT_PERCENTAGE));
+    stats.BlockPct = GetFloatValue(PLAYER_BLOCK_PERCENTAGE);
+    stats.DodgePct = GetFloatValue(PLAYER_DODGE_PERCENTAGE);
+    stats.ParryPct = GetFloatValue(PLAYER_PARRY_PERCENTAGE);
+    stats.CritPct = GetFloatValue(PLAYER_CRIT_PERCENTAGE);
+    stats.RangedCritPct = GetFloatValue(PLAYER_RANGED_CRIT_PERCENTAGE);
 
     // Store the max spell crit percentage out of all the possible schools
-    float spellCrit = 0.0f;
+    stats.SpellCritPct = 0.0f;
     for (int i = 0; i < MAX_SPELL_SCHOOL; ++i)
-        spellCrit = std::max(spellCrit, GetFloatValue(PLAYER_SPELL_CRIT_PERCENTAGE1 + i));
-    stmt->setFloat(index++, spellCrit);
+        stats.SpellCritPct = std::max(stats.SpellCritPct, GetFloatValue(PLAYER_SPELL_CRIT_PERCENTAGE1 + i));
 
-    stmt->setUInt32(index++, GetUInt32Value(UNIT_FIELD_ATTACK_POWER));
-    stmt->setUInt32(index++, GetUInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER));
-    stmt->setUInt32(index++, GetBaseSpellPowerBonus());
-    stmt->setUInt32(index++, GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + AsUnderlyingType(CR_CRIT_TAKEN_SPELL)));
+    stats.AttackPower = GetUInt32Value(UNIT_FIELD_ATTACK_POWER);
+    stats.RangedAttackPower = GetUInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER);
+    stats.SpellPower = GetBaseSpellPowerBonus();
+    stats.Resilience = GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + AsUnderlyingType(CR_CRIT_TAKEN_SPELL));
+
+    if (m_savedStats == stats)
+        return;
+
+    uint8 index = 0;
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_STATS);
+    stmt->setUInt32(index++, GetGUID().GetCounter());
+    stmt->setUInt32(index++, stats.MaxHealth);
 
+    for (uint8 i = 0; i < MAX_POWERS; ++i)
+        stmt->setUInt32(index++, stats.MaxPower[i]);
+
+    for (uint8 i = 0; i < MAX_STATS; ++i)
+        stmt->setUInt32(index++, stats.Stat[i]);
+
+    for (int i = 0; i < MAX_SPELL_SCHOOL; ++i)
+        stmt->setUInt32(index++, stats.Resistance[i]);
+
+    stmt->setFloat(index++, stats.BlockPct);
+    stmt->setFloat(index++, stats.DodgePct);
+    stmt->setFloat(index++, stats.ParryPct);
+    stmt->setFloat(index++, stats.CritPct);
+    stmt->setFloat(index++, stats.RangedCritPct);
+    stmt->setFloat(index++, stats.SpellCritPct);
+    stmt->setUInt32(index++, stats.AttackPower);
+    stmt->setUInt32(index++, stats.RangedAttackPower);
+    stmt->setUInt32(index++, stats.SpellPower);
+    stmt->setUInt32(index++, stats.Resilience);
     trans->Append(stmt);
+
+    m_savedStats = stats;
 }
 
 void Player::outDebugValues() const
@@ -508,6 +508,75 @@ struct SkillStatusData
 
 typedef std::unordered_map<uint32, SkillStatusData> SkillStatusMap;
 
+enum PlayerSaveSection : uint8
+{
+    PLAYER_SAVE_SECTION_CHARACTER = 0,
+    PLAYER_SAVE_SECTION_INVENTORY,
+    PLAYER_SAVE_SECTION_QUESTS,
+    PLAYER_SAVE_SECTION_SPELLS,
+    PLAYER_SAVE_SECTION_ACTIONS,
+    PLAYER_SAVE_SECTION_AURAS,
+    PLAYER_SAVE_SECTION_SKILLS,
+    PLAYER_SAVE_SECTION_ACHIEVEMENTS,
+    PLAYER_SAVE_SECTION_REPUTATION,
+    PLAYER_SAVE_SECTION_STATS,
+    PLAYER_SAVE_SECTION_OTHER,
+    MAX_PLAYER_SAVE_SECTIONS
+};
+
+struct PlayerSaveStatistics
+{
+    uint64 Saves;
+    std::array<uint64, MAX_PLAYER_SAVE_SECTIONS> Statements;
+};
+
+// character_aura row as last written, used to save only changed auras
+struct SavedAuraKey
+{
+    ObjectGuid CasterGuid;
+    ObjectGuid ItemGuid;
+    uint32 SpellId;
+    uint8 EffectMask;
+
+    std::strong_ordering operator<=>(SavedAuraKey const& right) const = default;
+};
+
+struct SavedAuraData
+{
+    uint8 RecalculateMask;
+    uint8 StackAmount;
+    std::array<int32, MAX_SPELL_EFFECTS> Amount;
+    std::array<int32, MAX_SPELL_EFFECTS> BaseAmount;
+    int32 MaxDuration;
+    int32 Duration;
+    uint8 Charges;
+    float CritChance;
+    bool ApplyResilience;
+
+    bool operator==(SavedAuraData const& right) const = default;
+};
+
+// character_stats row as last written
+struct SavedStatsData
+{
+    uint32 MaxHealth;
+    std::array<uint32, MAX_POWERS> MaxPower;
+    std::array<uint32, MAX_STATS> Stat;
+    std::array<uint32, MAX_SPELL_SCHOOL> Resistance;
+    float BlockPct;
+    float DodgePct;
+    float ParryPct;
+    float CritPct;
+    float RangedCritPct;
+    float SpellCritPct;
+    uint32 AttackPower;
+    uint32 RangedAttackPower;
+    uint32 SpellPower;
+    uint32 Resilience;
+
+    bool operator==(SavedStatsData const& right) const = default;
+};
+
 class Quest;
 class Spell;
 class Item;
@@ -1379,6 +1448,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void SaveToDB(CharacterDatabaseTransaction trans, bool create = false);
         void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
         void SaveGoldToDB(CharacterDatabaseTransaction trans) const;
+        static PlayerSaveStatistics GetSaveStatistics();
 
         static void Customize(CharacterCustomizeInfo const* customizeInfo, CharacterDatabaseTransaction trans);
         static void SavePositionInDB(WorldLocation const& loc, uint16 zoneId, ObjectGuid guid, CharacterDatabaseTransaction trans);
@@ -2336,7 +2406,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void _SaveBGData(CharacterDatabaseTransaction trans);
         void _SaveGlyphs(CharacterDatabaseTransaction trans) const;
         void _SaveTalents(CharacterDatabaseTransaction trans);
-        void _SaveStats(CharacterDatabaseTransaction trans) const;
+        void _SaveStats(CharacterDatabaseTransaction trans);
 
         /*********************************************************/
         /***              ENVIRONMENTAL SYSTEM                 ***/
@@ -2357,6 +2427,9 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
 
         uint32 m_team;
         uint32 m_nextSave;
+        std::map<SavedAuraKey, SavedAuraData> m_savedAuras;
+        bool m_savedAurasValid;                         // false until the first save replaced whatever character_aura held
+        Optional<SavedStatsData> m_savedStats;
         std::array<ChatFloodThrottle, ChatFloodThrottle::MAX> m_chatFloodData;
         Difficulty m_dungeonDifficulty;
         Difficulty m_raidDifficulty;
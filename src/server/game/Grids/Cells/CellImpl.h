@@ -18,6 +18,7 @@
 #ifndef TRINITY_CELLIMPL_H
 #define TRINITY_CELLIMPL_H
 
+#include <algorithm>
 #include <cmath>
 
 #include "Cell.h"
@@ -46,6 +47,21 @@ inline CellArea Cell::CalculateCellArea(float x, float y, float radius)
     return CellArea(centerX, centerY);
 }
 
+inline bool Cell::CalculateColumnSpan(float x, float y, float radius, CellArea const& area, uint32 column, uint32& low_y, uint32& high_y)
+{
+    //cell column covers [min_x, min_x + SIZE_OF_GRID_CELL) in world coordinates, see Trinity::ComputeCellCoord
+    float min_x = (float(column) - float(CENTER_GRID_CELL_ID)) * SIZE_OF_GRID_CELL;
+    float dx = std::max({ min_x - x, x - (min_x + SIZE_OF_GRID_CELL), 0.0f });
+    if (dx > radius)
+        return false;
+
+    //half height of the circle chord at the column edge closest to the center
+    float dy = std::sqrt(radius * radius - dx * dx);
+    low_y = std::max(area.low_bound.y_coord, Trinity::ComputeCellCoord(x, y - dy).normalize().y_coord);
+    high_y = std::min(area.high_bound.y_coord, Trinity::ComputeCellCoord(x, y + dy).normalize().y_coord);
+    return low_y <= high_y;
+}
+
 template<class T, class CONTAINER>
 inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, WorldObject const& obj, float radius) const
 {
@@ -81,24 +97,19 @@ inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T,
         return;
     }
 
-    //visit all cells, found in CalculateCellArea()
-    //if radius is known to reach cell area more than 4x4 then we should call optimized VisitCircle
-    //currently this technique works with MAX_NUMBER_OF_CELLS 16 and higher, with lower values
-    //there are nothing to optimize because SIZE_OF_GRID_CELL is too big...
-    if ((area.high_bound.x_coord > (area.low_bound.x_coord + 4)) && (area.high_bound.y_coord > (area.low_bound.y_coord + 4)))
-    {
-        VisitCircle(visitor, map, area.low_bound, area.high_bound);
-        return;
-    }
-
     //ALWAYS visit standing cell first!!! Since we deal with small radiuses
     //it is very essential to call visitor for standing cell firstly...
     map.Visit(*this, visitor);
 
-    // loop the cell range
+    //visit only the cells of the area which actually intersect the search circle,
+    //the corners of the bounding square are skipped column by column
     for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
     {
-        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        uint32 low_y, high_y;
+        if (!CalculateColumnSpan(x_off, y_off, radius, area, x, low_y, high_y))
+            continue;
+
+        for (uint32 y = low_y; y <= high_y; ++y)
         {
             CellCoord cellCoord(x, y);
             //lets skip standing cell since we already visited it
@@ -112,58 +123,6 @@ inline void Cell::Visit(CellCoord const& standing_cell, TypeContainerVisitor<T,
     }
 }
 
-template<class T, class CONTAINER>
-inline void Cell::VisitCircle(TypeContainerVisitor<T, CONTAINER>& visitor, Map& map, CellCoord const& begin_cell, CellCoord const& end_cell) const
-{
-    //here is an algorithm for 'filling' circum-squared octagon
-    uint32 x_shift = (uint32)ceilf((end_cell.x_coord - begin_cell.x_coord) * 0.3f - 0.5f);
-    //lets calculate x_start/x_end coords for central strip...
-    const uint32 x_start = begin_cell.x_coord + x_shift;
-    const uint32 x_end = end_cell.x_coord - x_shift;
-
-    //visit central strip with constant width...
-    for (uint32 x = x_start; x <= x_end; ++x)
-    {
-        for (uint32 y = begin_cell.y_coord; y <= end_cell.y_coord; ++y)
-        {
-            CellCoord cellCoord(x, y);
-            Cell r_zone(cellCoord);
-            r_zone.data.Part.nocreate = this->data.Part.nocreate;
-            map.Visit(r_zone, visitor);
-        }
-    }
-
-    //if x_shift == 0 then we have too small cell area, which were already
-    //visited at previous step, so just return from procedure...
-    if (x_shift == 0)
-        return;
-
-    uint32 y_start = end_cell.y_coord;
-    uint32 y_end = begin_cell.y_coord;
-    //now we are visiting borders of an octagon...
-    for (uint32 step = 1; step <= (x_start - begin_cell.x_coord); ++step)
-    {
-        //each step reduces strip height by 2 cells...
-        y_end += 1;
-        y_start -= 1;
-        for (uint32 y = y_start; y >= y_end; --y)
-        {
-            //we visit cells symmetrically from both sides, heading from center to sides and from up to bottom
-            //e.g. filling 2 trapezoids after filling central cell strip...
-            CellCoord cellCoord_left(x_start - step, y);
-            Cell r_zone_left(cellCoord_left);
-            r_zone_left.data.Part.nocreate = this->data.Part.nocreate;
-            map.Visit(r_zone_left, visitor);
-
-            //right trapezoid cell visit
-            CellCoord cellCoord_right(x_end + step, y);
-            Cell r_zone_right(cellCoord_right);
-            r_zone_right.data.Part.nocreate = this->data.Part.nocreate;
-            map.Visit(r_zone_right, visitor);
-        }
-    }
-}
-
 template<class T>
 inline void Cell::VisitGridObjects(WorldObject const* center_obj, T& visitor, float radius, bool dont_load /*= true*/)
 {
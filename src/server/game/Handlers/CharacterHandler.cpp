@@ -266,7 +266,8 @@ void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recvData*/)
     stmt->setUInt8(0, PET_SAVE_AS_CURRENT);
     stmt->setUInt32(1, GetAccountId());
 
-    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSession::HandleCharEnum, this, std::placeholders::_1)));
+    // HandleCharEnum only touches this session and the (thread safe) character cache, so it may run on a session update worker
+    _sessionLocalQueryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSession::HandleCharEnum, this, std::placeholders::_1)));
 }
 
 void WorldSession::HandleCharCreateOpcode(WorldPacket& recvData)
@@ -724,7 +725,9 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+    m_playerLoginStart = std::chrono::steady_clock::now();
+
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder, sWorld->getIntConfig(CONFIG_LOGIN_QUERY_PARALLELISM))).AfterComplete([this](SQLQueryHolderBase const& holder)
     {
         HandlePlayerLogin(static_cast<LoginQueryHolder const&>(holder));
     });
@@ -733,6 +736,7 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
 void WorldSession::HandlePlayerLogin(LoginQueryHolder const& holder)
 {
     ObjectGuid playerGuid = holder.GetGuid();
+    TimePoint loadStart = std::chrono::steady_clock::now();
 
     Player* pCurrChar = new Player(this);
      // for send server info and strings (config)
@@ -748,6 +752,8 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder const& holder)
         return;
     }
 
+    TimePoint loadEnd = std::chrono::steady_clock::now();
+
     pCurrChar->GetMotionMaster()->Initialize();
     pCurrChar->SendDungeonDifficulty(false);
 
@@ -1006,6 +1012,16 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder const& holder)
     sScriptMgr->OnPlayerLogin(pCurrChar, firstLogin);
 
     TC_METRIC_EVENT("player_events", "Login", pCurrChar->GetName());
+
+    // queries include the time spent waiting in the database queue and for the next session update
+    std::chrono::microseconds queryTime = std::chrono::duration_cast<std::chrono::microseconds>(loadStart - m_playerLoginStart);
+    std::chrono::microseconds loadTime = std::chrono::duration_cast<std::chrono::microseconds>(loadEnd - loadStart);
+    std::chrono::microseconds enterWorldTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadEnd);
+    TC_METRIC_VALUE("player_login_time", uint64(queryTime.count()), TC_METRIC_TAG("stage", "queries"));
+    TC_METRIC_VALUE("player_login_time", uint64(loadTime.count()), TC_METRIC_TAG("stage", "load"));
+    TC_METRIC_VALUE("player_login_time", uint64(enterWorldTime.count()), TC_METRIC_TAG("stage", "enter_world"));
+    TC_LOG_DEBUG("entities.player.loading", "Login of {} took {} us for queries, {} us to load and {} us to enter the world",
+        pCurrChar->GetGUID().ToString(), queryTime.count(), loadTime.count(), enterWorldTime.count());
 }
 
 void WorldSession::SendFeatureSystemStatus()
@@ -27,6 +27,48 @@
 #include "Random.h"
 #include "World.h"
 
+namespace
+{
+    // Item storage of destroyed loot, reused by loot generated later on the same thread
+    struct LootItemStorageCache
+    {
+        ~LootItemStorageCache();
+
+        std::vector<LootItemList> FreeStorage;
+    };
+
+    constexpr std::size_t MaxCachedLootItemStorage = 64;
+
+    thread_local LootItemStorageCache StorageCache;
+    // trivially destructible, stays valid for loot destroyed while the thread shuts down
+    thread_local bool StorageCacheDestroyed = false;
+
+    LootItemStorageCache::~LootItemStorageCache()
+    {
+        StorageCacheDestroyed = true;
+    }
+
+    void AcquireLootItemStorage(LootItemList& storage, std::size_t capacity)
+    {
+        if (storage.capacity() < capacity && !StorageCacheDestroyed && !StorageCache.FreeStorage.empty())
+        {
+            storage.swap(StorageCache.FreeStorage.back());
+            StorageCache.FreeStorage.pop_back();
+        }
+
+        storage.reserve(capacity);
+    }
+
+    void ReleaseLootItemStorage(LootItemList& storage)
+    {
+        storage.clear();
+        if (!storage.capacity() || StorageCacheDestroyed || StorageCache.FreeStorage.size() >= MaxCachedLootItemStorage)
+            return;
+
+        StorageCache.FreeStorage.push_back(std::move(storage));
+    }
+}
+
  //
  // --------- LootItem ---------
  //
@@ -122,6 +164,9 @@ Loot::Loot(uint32 _gold /*= 0*/) : gold(_gold), unlootedCount(0), roundRobinPlay
 Loot::~Loot()
 {
     clear();
+
+    ReleaseLootItemStorage(items);
+    ReleaseLootItemStorage(quest_items);
 }
 
 void Loot::clear()
@@ -213,8 +258,8 @@ bool Loot::FillLoot(uint32 lootId, LootStore const& store, Player* lootOwner, bo
         return false;
     }
 
-    items.reserve(MAX_NR_LOOT_ITEMS);
-    quest_items.reserve(MAX_NR_QUEST_ITEMS);
+    AcquireLootItemStorage(items, MAX_NR_LOOT_ITEMS);
+    AcquireLootItemStorage(quest_items, MAX_NR_QUEST_ITEMS);
 
     tab->Process(*this, store.IsRatesAllowed(), lootMode);          // Processing is done there, callback via Loot::AddItem()
 
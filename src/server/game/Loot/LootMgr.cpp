@@ -16,7 +16,7 @@
  */
 
 #include "LootMgr.h"
-#include "Containers.h"
+#include "AliasTable.h"
 #include "DatabaseEnv.h"
 #include "DBCStores.h"
 #include "Group.h"
@@ -59,7 +59,7 @@ struct LootGroupInvalidSelector
 {
     explicit LootGroupInvalidSelector(Loot const& loot, uint16 lootMode) : _loot(loot), _lootMode(lootMode) { }
 
-    bool operator()(LootStoreItem* item) const
+    bool operator()(LootStoreItem const* item) const
     {
         if (!(item->lootmode & _lootMode))
             return true;
@@ -85,6 +85,7 @@ class LootTemplate::LootGroup                               // A set of loot def
         ~LootGroup();
 
         void AddEntry(LootStoreItem* item);                 // Adds an entry to the group (at loading stage)
+        void Compile();                                     // Builds the selection table once all entries are added
         bool HasQuestDrop() const;                          // True if group includes at least 1 quest drop entry
         bool HasQuestDropForPlayer(Player const* player) const;
                                                             // The same for active quests of the player
@@ -100,6 +101,7 @@ class LootTemplate::LootGroup                               // A set of loot def
     private:
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+        AliasTable ExplicitlyChancedTable;                  // Selects from ExplicitlyChanced, the last column stands for no drop
 
         LootStoreItem const* Roll(Loot& loot, uint16 lootMode) const;   // Rolls an item from the group, returns NULL if all miss their chances
 
@@ -190,6 +192,9 @@ uint32 LootStore::LoadLootTable()
     }
     while (result->NextRow());
 
+    for (LootTemplateMap::value_type const& lootTemplate : m_LootTemplates)
+        lootTemplate.second->Compile();
+
     Verify();                                           // Checks validity of the loot store
 
     return count;
@@ -371,19 +376,50 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
         EqualChanced.push_back(item);
 }
 
+void LootTemplate::LootGroup::Compile()
+{
+    ExplicitlyChancedTable = AliasTable();
+
+    // Once the chances of the entries exceed 100% the order in which they are checked matters,
+    // those groups and groups with no chanced entries keep using the sequential roll
+    float totalChance = 0.0f;
+    for (LootStoreItem const* item : ExplicitlyChanced)
+        totalChance += item->chance;
+
+    if (ExplicitlyChanced.empty() || totalChance > 100.0f)
+        return;
+
+    std::vector<double> weights;
+    weights.reserve(ExplicitlyChanced.size() + 1);
+    for (LootStoreItem const* item : ExplicitlyChanced)
+        weights.push_back(item->chance);
+    weights.push_back(100.0f - totalChance);
+
+    ExplicitlyChancedTable = AliasTable(weights);
+}
+
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    // First explicitly chanced entries are checked
+    if (!ExplicitlyChancedTable.empty())
+    {
+        // the chance of a valid entry doesn't depend on the other entries, an invalid one counts as a miss
+        std::size_t index = ExplicitlyChancedTable.Select();
+        if (index < ExplicitlyChanced.size() && !isInvalid(ExplicitlyChanced[index]))
+            return ExplicitlyChanced[index];
+    }
+    else if (!ExplicitlyChanced.empty())
     {
         float roll = (float)rand_chance();
 
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        for (LootStoreItem const* item : ExplicitlyChanced)   // check each explicitly chanced entry in the template and modify its chance based on quality.
         {
-            LootStoreItem* item = *itr;
+            if (isInvalid(item))
+                continue;
+
             if (item->chance >= 100.0f)
                 return item;
 
@@ -393,12 +429,17 @@ LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, uint16 lootMode)
         }
     }
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
-    if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
+    // If nothing selected yet - an item is taken from equal-chanced part
+    uint32 possibleLootCount = uint32(std::count_if(EqualChanced.begin(), EqualChanced.end(), [&](LootStoreItem const* item) { return !isInvalid(item); }));
+    if (!possibleLootCount)
+        return nullptr;                                        // Empty drop from the group
 
-    return nullptr;                                            // Empty drop from the group
+    uint32 selected = urand(0, possibleLootCount - 1);
+    for (LootStoreItem const* item : EqualChanced)
+        if (!isInvalid(item) && !selected--)
+            return item;
+
+    return nullptr;
 }
 
 // True if group includes at least 1 quest drop entry
@@ -518,6 +559,14 @@ LootTemplate::~LootTemplate()
         delete Groups[i];
 }
 
+// Prepares the groups for rolling, called after all entries were added
+void LootTemplate::Compile()
+{
+    for (LootGroup* group : Groups)
+        if (group)
+            group->Compile();
+}
+
 // Adds an entry to the group (at loading stage)
 void LootTemplate::AddEntry(LootStoreItem* item)
 {
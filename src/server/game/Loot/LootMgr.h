@@ -22,7 +22,6 @@
 #include "ConditionMgr.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
-#include <list>
 #include <vector>
 
 class LootStore;
@@ -55,7 +54,7 @@ struct TC_GAME_API LootStoreItem
                                                             // Checks correctness of values
 };
 
-typedef std::list<LootStoreItem*> LootStoreItemList;
+typedef std::vector<LootStoreItem*> LootStoreItemList;
 typedef std::unordered_map<uint32, LootTemplate*> LootTemplateMap;
 
 typedef std::set<uint32> LootIdSet;
@@ -107,6 +106,8 @@ class TC_GAME_API LootTemplate
 
         // Adds an entry to the group (at loading stage)
         void AddEntry(LootStoreItem* item);
+        // Prepares the groups for rolling, called after all entries were added
+        void Compile();
         // Rolls for every item in the template and adds the rolled items the the loot
         void Process(Loot& loot, bool rate, uint16 lootMode, uint8 groupId = 0) const;
         void CopyConditions(ConditionContainer const& conditions);
@@ -29,9 +29,11 @@
 #include "GridStates.h"
 #include "Group.h"
 #include "InstanceScript.h"
+#include "IntrusiveHeap.h"
 #include "Log.h"
 #include "MapInstanced.h"
 #include "MapManager.h"
+#include "MapQueryCache.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MMapFactory.h"
@@ -42,6 +44,7 @@
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "StringFormat.h"
 #include "Transport.h"
 #include "Vehicle.h"
 #include "VMapFactory.h"
@@ -49,7 +52,7 @@
 #include "Weather.h"
 #include "WeatherMgr.h"
 #include "World.h"
-#include <boost/heap/fibonacci_heap.hpp>
+#include <iterator>
 #include <unordered_set>
 #include <vector>
 
@@ -73,20 +76,51 @@ ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), DefaultWeather(nullptr), Weathe
 
 RespawnInfo::~RespawnInfo() = default;
 
-struct RespawnInfoWithHandle;
-struct RespawnListContainer : boost::heap::fibonacci_heap<RespawnInfoWithHandle*, boost::heap::compare<CompareRespawnInfo>>
+struct RespawnInfoWithHandle : RespawnInfo
 {
+    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other), heapIndex(0) { }
+
+    std::size_t heapIndex;
 };
 
-struct RespawnInfoWithHandle : RespawnInfo
+struct RespawnListContainer : IntrusiveHeap<RespawnInfoWithHandle, CompareRespawnInfo, &RespawnInfoWithHandle::heapIndex>
+{
+};
+
+struct MapQueryCaches
 {
-    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other) { }
+    struct AreaInfoResult
+    {
+        bool Found = false;
+        uint32 MogpFlags = 0;
+        int32 AdtId = 0;
+        int32 RootId = 0;
+        int32 GroupId = 0;
+    };
+
+    explicit MapQueryCaches(uint32 size) : Height(size), AreaInfo(size), TerrainStatus(size), LineOfSight(size) { }
 
-    RespawnListContainer::handle_type handle;
+    uint64 GetHits() const { return Height.GetHits() + AreaInfo.GetHits() + TerrainStatus.GetHits() + LineOfSight.GetHits(); }
+    uint64 GetMisses() const { return Height.GetMisses() + AreaInfo.GetMisses() + TerrainStatus.GetMisses() + LineOfSight.GetMisses(); }
+
+    void ResetCounters()
+    {
+        Height.ResetCounters();
+        AreaInfo.ResetCounters();
+        TerrainStatus.ResetCounters();
+        LineOfSight.ResetCounters();
+    }
+
+    MapQueryCache<float, 5> Height;                                     // x, y, z, checkVMap, maxSearchDist
+    MapQueryCache<AreaInfoResult, 4> AreaInfo;                          // x, y, z, phaseMask
+    MapQueryCache<PositionFullTerrainStatus, 6> TerrainStatus;          // x, y, z, phaseMask, reqLiquidType, collisionHeight
+    MapQueryCache<bool, 8> LineOfSight;                                 // x1, y1, z1, x2, y2, z2, phaseMask, checks and ignoreFlags
 };
 
 Map::~Map()
 {
+    SavePendingRespawnTimes();
+
     // Delete all waiting spawns, else there will be a memory leak
     // This doesn't delete from database.
     UnloadAllRespawnInfos();
@@ -237,6 +271,7 @@ void Map::LoadMap(int gx, int gy, bool reload)
 
 void Map::LoadMapAndVMap(int gx, int gy)
 {
+    ++_terrainGeneration;
     LoadMap(gx, gy);
    // Only load the data for the base map
     if (i_InstanceId == 0)
@@ -278,6 +313,9 @@ m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transpo
 i_gridExpiry(expiry),
 i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0)
 {
+    _queryCaches = std::make_unique<MapQueryCaches>(sWorld->getIntConfig(CONFIG_MAP_QUERY_CACHE_SIZE));
+    _terrainGeneration = 1;
+
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
     {
@@ -542,6 +580,10 @@ bool Map::EnsureGridLoaded(Cell const& cell)
 
         grid->setGridObjectDataLoaded(true);
 
+        TC_METRIC_TIMER("map_grid_load_time",
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
         ObjectGridLoader loader(*grid, this, cell);
         loader.LoadN();
 
@@ -779,6 +821,7 @@ void Map::Update(uint32 t_diff)
     if (_respawnCheckTimer <= t_diff)
     {
         ProcessRespawns();
+        SavePendingRespawnTimes();
         _respawnCheckTimer = sWorld->getIntConfig(CONFIG_RESPAWN_MINCHECKINTERVALMS);
     }
     else
@@ -908,6 +951,16 @@ void Map::Update(uint32 t_diff)
     TC_METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         TC_METRIC_TAG("map_id", std::to_string(GetId())),
         TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_query_cache_hits", _queryCaches->GetHits(),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_query_cache_misses", _queryCaches->GetMisses(),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _queryCaches->ResetCounters();
 }
 
 struct ResetNotifier
@@ -1664,6 +1717,10 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
 
         TC_LOG_DEBUG("maps", "Unloading grid[{}, {}] for map {}", x, y, GetId());
 
+        TC_METRIC_TIMER("map_grid_unload_time",
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
         if (!unloadAll)
         {
             // Finish creature moves, remove and delete all creatures with delayed remove before moving to respawn grids
@@ -1720,6 +1777,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
             ((MapInstanced*)m_parentMap)->RemoveGridMapReference(GridCoord(gx, gy));
 
         GridMaps[gx][gy] = nullptr;
+        ++_terrainGeneration;
     }
     TC_LOG_DEBUG("maps", "Unloading grid[{}, {}] for map {} finished", x, y, GetId());
     return true;
@@ -2481,7 +2539,32 @@ float Map::GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, fl
     return VMAP_INVALID_HEIGHT_VALUE;
 }
 
+uint64 Map::GetQueryGeneration(float x1, float y1, float x2, float y2, bool dynamic) const
+{
+    uint64 generation = uint64(_terrainGeneration) << 32;
+    if (dynamic)
+        generation |= _dynamicTree.getGeneration(x1, y1, x2, y2);
+    return generation;
+}
+
 float Map::GetHeight(float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    MapQueryCache<float, 5>::Key key;
+    if (!_queryCaches->Height.IsEnabled()
+        || !MapQueryCache<float, 5>::Quantize(x, key[0])
+        || !MapQueryCache<float, 5>::Quantize(y, key[1])
+        || !MapQueryCache<float, 5>::Quantize(z, key[2]))
+        return ComputeHeight(x, y, z, checkVMap, maxSearchDist);
+
+    key[3] = checkVMap;
+    key[4] = MapQueryCache<float, 5>::KeyPart(maxSearchDist);
+    return _queryCaches->Height.Get(key, GetQueryGeneration(x, y, x, y, false), [&]
+    {
+        return ComputeHeight(x, y, z, checkVMap, maxSearchDist);
+    });
+}
+
+float Map::ComputeHeight(float x, float y, float z, bool checkVMap, float maxSearchDist) const
 {
     // find raw .map surface under Z coordinates
     float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
@@ -2541,6 +2624,34 @@ static inline bool IsInWMOInterior(uint32 mogpFlags)
 }
 
 bool Map::GetAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const
+{
+    using AreaInfoCache = decltype(_queryCaches->AreaInfo);
+    AreaInfoCache::Key key;
+    if (!_queryCaches->AreaInfo.IsEnabled()
+        || !AreaInfoCache::Quantize(x, key[0])
+        || !AreaInfoCache::Quantize(y, key[1])
+        || !AreaInfoCache::Quantize(z, key[2]))
+        return ComputeAreaInfo(phaseMask, x, y, z, flags, adtId, rootId, groupId);
+
+    key[3] = phaseMask;
+    MapQueryCaches::AreaInfoResult result = _queryCaches->AreaInfo.Get(key, GetQueryGeneration(x, y, x, y, true), [&]
+    {
+        MapQueryCaches::AreaInfoResult info;
+        info.Found = ComputeAreaInfo(phaseMask, x, y, z, info.MogpFlags, info.AdtId, info.RootId, info.GroupId);
+        return info;
+    });
+
+    if (!result.Found)
+        return false;
+
+    flags = result.MogpFlags;
+    adtId = result.AdtId;
+    rootId = result.RootId;
+    groupId = result.GroupId;
+    return true;
+}
+
+bool Map::ComputeAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const
 {
     float check_z = z;
     VMAP::IVMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
@@ -2579,11 +2690,17 @@ bool Map::GetAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& flags
 }
 
 uint32 Map::GetAreaId(uint32 phaseMask, float x, float y, float z) const
+{
+    return ComputeAreaId(phaseMask, x, y, z, true);
+}
+
+uint32 Map::ComputeAreaId(uint32 phaseMask, float x, float y, float z, bool useCache) const
 {
     uint32 mogpFlags;
     int32 adtId, rootId, groupId;
     float vmapZ = z;
-    bool hasVmapArea = GetAreaInfo(phaseMask, x, y, vmapZ, mogpFlags, adtId, rootId, groupId);
+    bool hasVmapArea = useCache ? GetAreaInfo(phaseMask, x, y, vmapZ, mogpFlags, adtId, rootId, groupId)
+        : ComputeAreaInfo(phaseMask, x, y, vmapZ, mogpFlags, adtId, rootId, groupId);
 
     uint32 gridAreaId = 0;
     float gridMapHeight = INVALID_HEIGHT;
@@ -2614,9 +2731,8 @@ uint32 Map::GetAreaId(uint32 phaseMask, float x, float y, float z) const
     return areaId;
 }
 
-uint32 Map::GetZoneId(uint32 phaseMask, float x, float y, float z) const
+static uint32 GetZoneIdForArea(uint32 areaId)
 {
-    uint32 areaId = GetAreaId(phaseMask, x, y, z);
     if (AreaTableEntry const* area = sAreaTableStore.LookupEntry(areaId))
         if (area->ParentAreaID)
             return area->ParentAreaID;
@@ -2624,12 +2740,26 @@ uint32 Map::GetZoneId(uint32 phaseMask, float x, float y, float z) const
     return areaId;
 }
 
+uint32 Map::GetZoneId(uint32 phaseMask, float x, float y, float z) const
+{
+    return GetZoneIdForArea(GetAreaId(phaseMask, x, y, z));
+}
+
+uint32 Map::GetZoneIdUncached(uint32 phaseMask, float x, float y, float z) const
+{
+    return GetZoneIdForArea(GetAreaIdUncached(phaseMask, x, y, z));
+}
+
 void Map::GetZoneAndAreaId(uint32 phaseMask, uint32& zoneid, uint32& areaid, float x, float y, float z) const
 {
-    areaid = zoneid = GetAreaId(phaseMask, x, y, z);
-    if (AreaTableEntry const* area = sAreaTableStore.LookupEntry(areaid))
-        if (area->ParentAreaID)
-            zoneid = area->ParentAreaID;
+    areaid = GetAreaId(phaseMask, x, y, z);
+    zoneid = GetZoneIdForArea(areaid);
+}
+
+void Map::GetZoneAndAreaIdUncached(uint32 phaseMask, uint32& zoneid, uint32& areaid, float x, float y, float z) const
+{
+    areaid = GetAreaIdUncached(phaseMask, x, y, z);
+    zoneid = GetZoneIdForArea(areaid);
 }
 
 ZLiquidStatus Map::GetLiquidStatus(uint32 phaseMask, float x, float y, float z, Optional<uint8> ReqLiquidType, LiquidData* data, float collisionHeight) const
@@ -2721,6 +2851,30 @@ ZLiquidStatus Map::GetLiquidStatus(uint32 phaseMask, float x, float y, float z,
 }
 
 void Map::GetFullTerrainStatusForPosition(uint32 phaseMask, float x, float y, float z, PositionFullTerrainStatus& data, Optional<uint8> reqLiquidType, float collisionHeight) const
+{
+    using TerrainStatusCache = decltype(_queryCaches->TerrainStatus);
+    TerrainStatusCache::Key key;
+    if (!_queryCaches->TerrainStatus.IsEnabled()
+        || !TerrainStatusCache::Quantize(x, key[0])
+        || !TerrainStatusCache::Quantize(y, key[1])
+        || !TerrainStatusCache::Quantize(z, key[2]))
+    {
+        ComputeFullTerrainStatusForPosition(phaseMask, x, y, z, data, reqLiquidType, collisionHeight);
+        return;
+    }
+
+    key[3] = phaseMask;
+    key[4] = reqLiquidType ? *reqLiquidType : 0x100;
+    key[5] = TerrainStatusCache::KeyPart(collisionHeight);
+    data = _queryCaches->TerrainStatus.Get(key, GetQueryGeneration(x, y, x, y, true), [&]
+    {
+        PositionFullTerrainStatus status;
+        ComputeFullTerrainStatusForPosition(phaseMask, x, y, z, status, reqLiquidType, collisionHeight);
+        return status;
+    });
+}
+
+void Map::ComputeFullTerrainStatusForPosition(uint32 phaseMask, float x, float y, float z, PositionFullTerrainStatus& data, Optional<uint8> reqLiquidType, float collisionHeight) const
 {
     VMAP::IVMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
     VMAP::AreaAndLiquidData vmapData;
@@ -2868,6 +3022,30 @@ float Map::GetWaterLevel(float x, float y) const
 }
 
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    using LineOfSightCache = decltype(_queryCaches->LineOfSight);
+    LineOfSightCache::Key key;
+    if (!_queryCaches->LineOfSight.IsEnabled()
+        || !LineOfSightCache::Quantize(x1, key[0])
+        || !LineOfSightCache::Quantize(y1, key[1])
+        || !LineOfSightCache::Quantize(z1, key[2])
+        || !LineOfSightCache::Quantize(x2, key[3])
+        || !LineOfSightCache::Quantize(y2, key[4])
+        || !LineOfSightCache::Quantize(z2, key[5]))
+        return ComputeLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags);
+
+    if (!sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS))
+        checks = LineOfSightChecks(checks & ~LINEOFSIGHT_CHECK_GOBJECT);
+
+    key[6] = phasemask;
+    key[7] = uint32(checks) | uint32(ignoreFlags) << 8;
+    return _queryCaches->LineOfSight.Get(key, GetQueryGeneration(x1, y1, x2, y2, (checks & LINEOFSIGHT_CHECK_GOBJECT) != 0), [&]
+    {
+        return ComputeLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags);
+    });
+}
+
+bool Map::ComputeLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
     if ((checks & LINEOFSIGHT_CHECK_VMAP)
       && !VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
@@ -2878,6 +3056,20 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     return true;
 }
 
+void Map::isInLineOfSight(std::vector<VMAP::LineOfSightQuery>& queries, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+        VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), queries, ignoreFlags);
+    else
+        for (VMAP::LineOfSightQuery& query : queries)
+            query.InLineOfSight = true;
+
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT))
+        for (VMAP::LineOfSightQuery& query : queries)
+            if (query.InLineOfSight)
+                query.InLineOfSight = _dynamicTree.isInLineOfSight(query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2, query.PhaseMask);
+}
+
 bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -3105,7 +3297,7 @@ void Map::Respawn(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
     if (info->respawnTime <= GameTime::GetGameTime())
         return;
     info->respawnTime = GameTime::GetGameTime();
-    _respawnTimes->increase(static_cast<RespawnInfoWithHandle*>(info)->handle);
+    _respawnTimes->update(static_cast<RespawnInfoWithHandle*>(info));
     SaveRespawnInfoDB(*info, dbTrans);
 }
 
@@ -3160,7 +3352,7 @@ bool Map::AddRespawnInfo(RespawnInfo const& info)
         ABORT_MSG("Invalid respawn info for spawn id (%u,%u) being inserted", uint32(info.type), info.spawnId);
 
     RespawnInfoWithHandle* ri = new RespawnInfoWithHandle(info);
-    ri->handle = _respawnTimes->push(ri);
+    _respawnTimes->push(ri);
     bySpawnIdMap.emplace(ri->spawnId, ri);
     return true;
 }
@@ -3211,7 +3403,7 @@ void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTr
     spawnMap.erase(it);
 
     // respawn heap
-    _respawnTimes->erase(static_cast<RespawnInfoWithHandle*>(info)->handle);
+    _respawnTimes->erase(static_cast<RespawnInfoWithHandle*>(info));
 
     // database
     DeleteRespawnInfoFromDB(info->type, info->spawnId, dbTrans);
@@ -3222,6 +3414,15 @@ void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTr
 
 void Map::DeleteRespawnInfoFromDB(SpawnObjectType type, ObjectGuid::LowType spawnId, CharacterDatabaseTransaction dbTrans)
 {
+    // without a transaction of the caller the row is deleted with the next batch
+    if (!dbTrans)
+    {
+        _pendingRespawnTimes[{ type, spawnId }] = 0;
+        return;
+    }
+
+    _pendingRespawnTimes.erase({ type, spawnId });
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_RESPAWN);
     stmt->setUInt16(0, type);
     stmt->setUInt32(1, spawnId);
@@ -3259,6 +3460,7 @@ void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gr
 void Map::ProcessRespawns()
 {
     time_t now = GameTime::GetGameTime();
+    uint32 respawned = 0;
     while (!_respawnTimes->empty())
     {
         RespawnInfoWithHandle* next = _respawnTimes->top();
@@ -3286,6 +3488,7 @@ void Map::ProcessRespawns()
 
             // step 2: do the respawn, which involves external logic
             DoRespawn(next->type, next->spawnId, next->gridId);
+            ++respawned;
 
             // step 3: get rid of the actual entry
             RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
@@ -3301,10 +3504,18 @@ void Map::ProcessRespawns()
         else
         { // new respawn time, update heap position
             ASSERT(now < next->respawnTime); // infinite loop guard
-            _respawnTimes->decrease(next->handle);
+            _respawnTimes->update(next);
             SaveRespawnInfoDB(*next);
         }
     }
+
+    TC_METRIC_VALUE("map_respawns", respawned,
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    TC_METRIC_VALUE("map_respawns_scheduled", uint64(_respawnTimes->size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
 }
 
 void Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::LowType spawnId, uint32& respawnDelay, uint32 mode) const
@@ -4490,6 +4701,15 @@ void Map::SaveRespawnTime(SpawnObjectType type, ObjectGuid::LowType spawnId, uin
 
 void Map::SaveRespawnInfoDB(RespawnInfo const& info, CharacterDatabaseTransaction dbTrans)
 {
+    // without a transaction of the caller the row is written with the next batch
+    if (!dbTrans)
+    {
+        _pendingRespawnTimes[{ info.type, info.spawnId }] = info.respawnTime;
+        return;
+    }
+
+    _pendingRespawnTimes.erase({ info.type, info.spawnId });
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_RESPAWN);
     stmt->setUInt16(0, info.type);
     stmt->setUInt32(1, info.spawnId);
@@ -4499,6 +4719,73 @@ void Map::SaveRespawnInfoDB(RespawnInfo const& info, CharacterDatabaseTransactio
     CharacterDatabase.ExecuteOrAppend(dbTrans, stmt);
 }
 
+// Writes all respawn times changed since the last call in one transaction, with multi row statements
+void Map::SavePendingRespawnTimes()
+{
+    if (_pendingRespawnTimes.empty())
+        return;
+
+    // keeps single statements at a reasonable size
+    static constexpr uint32 MaxRowsPerStatement = 500;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    std::string replaceSql, deleteSql;
+    uint32 replaceRows = 0, deleteRows = 0;
+
+    auto appendReplace = [&]()
+    {
+        trans->Append(replaceSql.c_str());
+        replaceSql.clear();
+        replaceRows = 0;
+    };
+
+    auto appendDelete = [&]()
+    {
+        deleteSql += ")";
+        trans->Append(deleteSql.c_str());
+        deleteSql.clear();
+        deleteRows = 0;
+    };
+
+    for (auto const& [key, respawnTime] : _pendingRespawnTimes)
+    {
+        if (respawnTime)
+        {
+            if (!replaceRows)
+                replaceSql = "REPLACE INTO respawn (type, spawnId, respawnTime, mapId, instanceId) VALUES ";
+            else
+                replaceSql += ',';
+
+            Trinity::StringFormatTo(std::back_inserter(replaceSql), "({},{},{},{},{})", uint32(key.first), key.second, uint64(respawnTime), GetId(), GetInstanceId());
+            if (++replaceRows == MaxRowsPerStatement)
+                appendReplace();
+        }
+        else
+        {
+            if (!deleteRows)
+                Trinity::StringFormatTo(std::back_inserter(deleteSql), "DELETE FROM respawn WHERE mapId = {} AND instanceId = {} AND (type, spawnId) IN (", GetId(), GetInstanceId());
+            else
+                deleteSql += ',';
+
+            Trinity::StringFormatTo(std::back_inserter(deleteSql), "({},{})", uint32(key.first), key.second);
+            if (++deleteRows == MaxRowsPerStatement)
+                appendDelete();
+        }
+    }
+
+    if (replaceRows)
+        appendReplace();
+    if (deleteRows)
+        appendDelete();
+
+    TC_METRIC_VALUE("map_respawn_saves", uint64(_pendingRespawnTimes.size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _pendingRespawnTimes.clear();
+    CharacterDatabase.CommitTransaction(trans);
+}
+
 void Map::LoadRespawnTimes()
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_RESPAWNS);
@@ -29,6 +29,7 @@
 #include "MPSCQueue.h"
 #include "ObjectGuid.h"
 #include "Optional.h"
+#include "ScratchBufferPool.h"
 #include "SharedDefines.h"
 #include "SpawnData.h"
 #include "Timer.h"
@@ -36,6 +37,7 @@
 #include "UniqueTrackablePtr.h"
 #include <bitset>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 
@@ -59,6 +61,7 @@ class WorldPacket;
 class WorldSession;
 struct MapDifficulty;
 struct MapEntry;
+struct MapQueryCaches;
 struct Position;
 struct ScriptAction;
 struct ScriptInfo;
@@ -67,7 +70,7 @@ enum Difficulty : uint8;
 enum WeatherState : uint32;
 
 namespace Trinity { struct ObjectUpdater; }
-namespace VMAP { enum class ModelIgnoreFlags : uint32; }
+namespace VMAP { enum class ModelIgnoreFlags : uint32; struct LineOfSightQuery; }
 namespace G3D { class Plane; }
 
 struct ScriptAction
@@ -367,6 +370,11 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void GetZoneAndAreaId(uint32 phaseMask, uint32& zoneid, uint32& areaid, float x, float y, float z) const;
         void GetZoneAndAreaId(uint32 phaseMask, uint32& zoneid, uint32& areaid, Position const& pos) const { GetZoneAndAreaId(phaseMask, zoneid, areaid, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ()); }
 
+        // Same as above without the query cache, which only the thread updating this map may use
+        uint32 GetAreaIdUncached(uint32 phaseMask, float x, float y, float z) const { return ComputeAreaId(phaseMask, x, y, z, false); }
+        uint32 GetZoneIdUncached(uint32 phaseMask, float x, float y, float z) const;
+        void GetZoneAndAreaIdUncached(uint32 phaseMask, uint32& zoneid, uint32& areaid, float x, float y, float z) const;
+
         float GetWaterLevel(float x, float y) const;
         bool IsInWater(uint32 phaseMask, float x, float y, float z, LiquidData* data = nullptr) const;
         bool IsUnderWater(uint32 phaseMask, float x, float y, float z) const;
@@ -531,16 +539,23 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return std::max<float>(GetHeight(x, y, z, vmap, maxSearchDist), GetGameObjectFloor(phasemask, x, y, z, maxSearchDist)); }
         float GetHeight(uint32 phasemask, Position const& pos, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return GetHeight(phasemask, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), vmap, maxSearchDist); }
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        // same as above for many segments in one area, results are stored in the queries
+        void isInLineOfSight(std::vector<VMAP::LineOfSightQuery>& queries, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
         void Balance() { _dynamicTree.balance(); }
         void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); }
         void InsertGameObjectModel(GameObjectModel const& model) { _dynamicTree.insert(model); }
         bool ContainsGameObjectModel(GameObjectModel const& model) const { return _dynamicTree.contains(model);}
+        void RelocateGameObjectModel(GameObjectModel const& model) { _dynamicTree.relocate(model); }
+        void InvalidateGameObjectModel(GameObjectModel const& model) { _dynamicTree.invalidate(model); }
         float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
         {
             return _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask);
         }
         bool getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float &ry, float& rz, float modifyDist);
 
+        // reusable object lists for searches done while updating this map, such as spell target selection
+        ScratchBufferPool<WorldObject*>& GetObjectBufferPool() { return _objectBuffers; }
+
         /*
             RESPAWN TIMES
         */
@@ -559,7 +574,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void SaveRespawnTime(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 entry, time_t respawnTime, uint32 gridId, CharacterDatabaseTransaction dbTrans = nullptr, bool startup = false);
         void SaveRespawnInfoDB(RespawnInfo const& info, CharacterDatabaseTransaction dbTrans = nullptr);
         void LoadRespawnTimes();
-        void DeleteRespawnTimes() { UnloadAllRespawnInfos(); DeleteRespawnTimesInDB(GetId(), GetInstanceId()); }
+        void SavePendingRespawnTimes();
+        void DeleteRespawnTimes() { UnloadAllRespawnInfos(); _pendingRespawnTimes.clear(); DeleteRespawnTimesInDB(GetId(), GetInstanceId()); }
         static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId);
 
         void LoadCorpseData();
@@ -679,6 +695,12 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
 
+        // cached terrain and line of sight query results, _terrainGeneration changes with every loaded or unloaded grid
+        std::unique_ptr<MapQueryCaches> _queryCaches;
+        uint32 _terrainGeneration;
+
+        ScratchBufferPool<WorldObject*> _objectBuffers;
+
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
 
@@ -704,6 +726,14 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void _ScriptProcessDoor(Object* source, Object* target, ScriptInfo const* scriptInfo) const;
         GameObject* _FindGameObject(WorldObject* pWorldObject, ObjectGuid::LowType guid) const;
 
+        // uncached versions of the terrain queries
+        float ComputeHeight(float x, float y, float z, bool checkVMap, float maxSearchDist) const;
+        bool ComputeAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& mogpflags, int32& adtId, int32& rootId, int32& groupId) const;
+        uint32 ComputeAreaId(uint32 phaseMask, float x, float y, float z, bool useCache) const;
+        void ComputeFullTerrainStatusForPosition(uint32 phaseMask, float x, float y, float z, PositionFullTerrainStatus& data, Optional<uint8> reqLiquidType, float collisionHeight) const;
+        bool ComputeLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        uint64 GetQueryGeneration(float x1, float y1, float x2, float y2, bool dynamic) const;
+
         time_t i_gridExpiry;
 
         //used for fast base_map (e.g. MapInstanced class object) search for
@@ -811,6 +841,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         }
 
         std::unique_ptr<RespawnListContainer> _respawnTimes;
+        // respawn times not yet written to the database, zero deletes the row
+        std::map<std::pair<SpawnObjectType, ObjectGuid::LowType>, time_t> _pendingRespawnTimes;
         RespawnInfoMap       _creatureRespawnTimesBySpawnId;
         RespawnInfoMap       _gameObjectRespawnTimesBySpawnId;
         RespawnInfoMap& GetRespawnMapForType(SpawnObjectType type)
@@ -0,0 +1,123 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MAP_QUERY_CACHE_H
+#define TRINITYCORE_MAP_QUERY_CACHE_H
+
+#include "Define.h"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <vector>
+
+/*
+ * Bounded direct mapped cache for terrain and collision query results of a single map.
+ *
+ * Coordinates are snapped to a 1/QuantizationScale yard lattice before querying, so a
+ * cached result is exactly what a fresh query at the snapped position would return.
+ * Every entry remembers the generation it was computed in, a caller passes the current
+ * generation of the data the query depends on and any mismatch is treated as a miss.
+ *
+ * Not thread safe, owned by the map like its DynamicMapTree.
+ */
+template<class Value, std::size_t KeySize>
+class MapQueryCache
+{
+public:
+    using Key = std::array<uint32, KeySize>;
+
+    static constexpr float QuantizationScale = 32.0f;
+
+    explicit MapQueryCache(uint32 size = 0) : _mask(0), _hits(0), _misses(0)
+    {
+        Resize(size);
+    }
+
+    //! size is rounded down to a power of two, 0 disables the cache
+    void Resize(uint32 size)
+    {
+        _slots.clear();
+        _slots.shrink_to_fit();
+        _mask = size ? std::bit_floor(size) - 1 : 0;
+        _enabled = size != 0;
+    }
+
+    bool IsEnabled() const { return _enabled; }
+
+    //! snaps a coordinate to the cache lattice, returns false for values that can't be cached
+    static bool Quantize(float& value, uint32& keyPart)
+    {
+        if (!std::isfinite(value) || std::fabs(value) > 1.0e6f)
+            return false;
+
+        int32 quantized = int32(std::lround(value * QuantizationScale));
+        value = float(quantized) / QuantizationScale;
+        keyPart = uint32(quantized);
+        return true;
+    }
+
+    static uint32 KeyPart(float value) { return std::bit_cast<uint32>(value); }
+
+    template<class Query>
+    Value Get(Key const& key, uint64 generation, Query&& query)
+    {
+        // slots are allocated on first use, most instance maps never query most of their caches
+        if (_slots.empty())
+            _slots.resize(std::size_t(_mask) + 1);
+
+        Slot& slot = _slots[Hash(key) & _mask];
+        if (slot.Generation == generation && slot.QueryKey == key)
+        {
+            ++_hits;
+            return slot.Result;
+        }
+
+        ++_misses;
+        slot.Result = query();
+        slot.QueryKey = key;
+        slot.Generation = generation;
+        return slot.Result;
+    }
+
+    uint64 GetHits() const { return _hits; }
+    uint64 GetMisses() const { return _misses; }
+    void ResetCounters() { _hits = 0; _misses = 0; }
+
+private:
+    struct Slot
+    {
+        Key QueryKey = { };
+        uint64 Generation = 0;  // generations start at 1, 0 marks an empty slot
+        Value Result = { };
+    };
+
+    static uint32 Hash(Key const& key)
+    {
+        uint32 hash = 2166136261u;
+        for (uint32 part : key)
+            hash = (hash ^ part) * 16777619u;
+        return hash ^ (hash >> 15);
+    }
+
+    std::vector<Slot> _slots;
+    uint32 _mask;
+    bool _enabled;
+    uint64 _hits;
+    uint64 _misses;
+};
+
+#endif // TRINITYCORE_MAP_QUERY_CACHE_H
@@ -105,6 +105,60 @@ template<>
 struct is_script_database_bound<AchievementCriteriaScript>
     : std::true_type { };
 
+// Frequently called hooks which are dispatched through per hook subscriber lists
+enum class UnitScriptHook : uint8
+{
+    OnHeal,
+    OnDamage,
+    ModifyPeriodicDamageAurasTick,
+    ModifyMeleeDamage,
+    ModifySpellDamageTaken,
+    Max
+};
+
+enum class PlayerScriptHook : uint8
+{
+    OnMoneyChanged,
+    OnGiveXP,
+    OnChat,
+    OnWhisper,
+    OnGroupChat,
+    OnGuildChat,
+    OnChannelChat,
+    OnSpellCast,
+    OnUpdateZone,
+    Max
+};
+
+enum class WorldScriptHook : uint8
+{
+    OnUpdate,
+    Max
+};
+
+template<typename>
+struct script_hook_count
+    : std::integral_constant<std::size_t, 0> { };
+
+template<>
+struct script_hook_count<UnitScript>
+    : std::integral_constant<std::size_t, std::size_t(UnitScriptHook::Max)> { };
+
+template<>
+struct script_hook_count<PlayerScript>
+    : std::integral_constant<std::size_t, std::size_t(PlayerScriptHook::Max)> { };
+
+template<>
+struct script_hook_count<WorldScript>
+    : std::integral_constant<std::size_t, std::size_t(WorldScriptHook::Max)> { };
+
+namespace
+{
+    // Set by the default implementation of a dispatched hook,
+    // tells the dispatcher that the script doesn't override it.
+    thread_local bool ScriptHookNotOverridden = false;
+}
+
 enum Spells
 {
     SPELL_HOTSWAP_VISUAL_SPELL_EFFECT = 40162 // 59084
@@ -886,6 +940,62 @@ public:
     }
 };
 
+// Scripts that receive a hook. Starts out with all scripts of the type,
+// scripts are dropped the first time their call ends up in the default implementation.
+// Lists are replaced instead of modified, so a map thread iterating an older
+// version is never invalidated. Older versions are kept until the next Reset,
+// which only happens while the script contexts change and no map is updated.
+template<typename ScriptType>
+class ScriptHookSubscribers
+{
+public:
+    typedef std::vector<ScriptType*> SubscriberList;
+
+    ScriptHookSubscribers()
+    {
+        Reset({ });
+    }
+
+    ScriptHookSubscribers(ScriptHookSubscribers const&) = delete;
+    ScriptHookSubscribers& operator=(ScriptHookSubscribers const&) = delete;
+
+    SubscriberList const& GetSubscribers() const
+    {
+        return *_current.load(std::memory_order_acquire);
+    }
+
+    void Reset(SubscriberList scripts)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _versions.clear();
+        Publish(std::move(scripts));
+    }
+
+    void Unsubscribe(ScriptType* script)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        SubscriberList scripts = *_current.load(std::memory_order_relaxed);
+        auto itr = std::find(scripts.begin(), scripts.end(), script);
+        // another thread might have been faster
+        if (itr == scripts.end())
+            return;
+
+        scripts.erase(itr);
+        Publish(std::move(scripts));
+    }
+
+private:
+    void Publish(SubscriberList&& scripts)
+    {
+        _versions.push_back(std::make_unique<SubscriberList const>(std::move(scripts)));
+        _current.store(_versions.back().get(), std::memory_order_release);
+    }
+
+    std::atomic<SubscriberList const*> _current;
+    std::mutex _lock;
+    std::vector<std::unique_ptr<SubscriberList const>> _versions;
+};
+
 // Database unbound script registry
 template<typename ScriptType>
 class SpecializedScriptRegistry<ScriptType, false>
@@ -906,11 +1016,14 @@ public:
         this->BeforeReleaseContext(context);
 
         _scripts.erase(context);
+        ResetHookSubscribers();
     }
 
     void SwapContext(bool initialize) final override
     {
         this->BeforeSwapContext(initialize);
+
+        ResetHookSubscribers();
     }
 
     void RemoveUsedScriptsFromContainer(std::unordered_set<std::string>& scripts) final override
@@ -924,6 +1037,7 @@ public:
         this->BeforeUnload();
 
         _scripts.clear();
+        ResetHookSubscribers();
     }
 
     // Adds a non database bound script
@@ -955,8 +1069,30 @@ public:
         return _scripts;
     }
 
+    template<typename Hook>
+    ScriptHookSubscribers<ScriptType>& GetHookSubscribers(Hook hook)
+    {
+        return _hookSubscribers[static_cast<std::size_t>(hook)];
+    }
+
 private:
+    // Scripts added to a new context are only dispatched to after SwapContext
+    void ResetHookSubscribers()
+    {
+        if (_hookSubscribers.empty())
+            return;
+
+        typename ScriptHookSubscribers<ScriptType>::SubscriberList scripts;
+        scripts.reserve(_scripts.size());
+        for (auto const& script : _scripts)
+            scripts.push_back(script.second.get());
+
+        for (ScriptHookSubscribers<ScriptType>& subscribers : _hookSubscribers)
+            subscribers.Reset(scripts);
+    }
+
     ScriptStoreType _scripts;
+    std::array<ScriptHookSubscribers<ScriptType>, script_hook_count<ScriptType>::value> _hookSubscribers;
 };
 
 // Utility macros to refer to the script registry.
@@ -981,6 +1117,33 @@ private:
     FOR_SCRIPTS(T, itr, end) \
         itr->second
 
+// Calls a hook on the scripts overriding it, see ScriptHookSubscribers.
+template<typename ScriptType, typename Hook, typename Call>
+void DispatchScriptHook(Hook hook, Call&& call)
+{
+    ScriptHookSubscribers<ScriptType>& subscribers = ScriptRegistry<ScriptType>::Instance()->GetHookSubscribers(hook);
+    typename ScriptHookSubscribers<ScriptType>::SubscriberList const& scripts = subscribers.GetSubscribers();
+    if (scripts.empty())
+        return;
+
+    // hooks may dispatch other hooks, keep the flag of the outer call intact
+    bool const outerNotOverridden = ScriptHookNotOverridden;
+    for (ScriptType* script : scripts)
+    {
+        ScriptHookNotOverridden = false;
+        call(script);
+        if (ScriptHookNotOverridden)
+            subscribers.Unsubscribe(script);
+    }
+    ScriptHookNotOverridden = outerNotOverridden;
+}
+
+#define FOREACH_SCRIPT_HOOK(T, H, ...) \
+    DispatchScriptHook<T>(T##Hook::H, [&](T* script) { script->H(__VA_ARGS__); })
+
+#define FOREACH_SCRIPT_HOOK_ALIAS(T, H, A, ...) \
+    DispatchScriptHook<T>(T##Hook::A, [&](T* script) { script->H(__VA_ARGS__); })
+
 // Utility macros for finding specific scripts.
 #define GET_SCRIPT(T, I, V) \
     T* V = ScriptRegistry<T>::Instance()->GetScriptById(I); \
@@ -1336,7 +1499,7 @@ void ScriptMgr::OnShutdownCancel()
 
 void ScriptMgr::OnWorldUpdate(uint32 diff)
 {
-    FOREACH_SCRIPT(WorldScript)->OnUpdate(diff);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnUpdate, diff);
 }
 
 void ScriptMgr::OnHonorCalculation(float& honor, uint8 level, float multiplier)
@@ -1850,7 +2013,7 @@ void ScriptMgr::OnPlayerTalentsReset(Player* player, bool involuntarily)
 
 void ScriptMgr::OnPlayerMoneyChanged(Player* player, int32& amount)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyChanged(player, amount);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnMoneyChanged, player, amount);
 }
 
 void ScriptMgr::OnPlayerMoneyLimit(Player* player, int32 amount)
@@ -1860,7 +2023,7 @@ void ScriptMgr::OnPlayerMoneyLimit(Player* player, int32 amount)
 
 void ScriptMgr::OnGivePlayerXP(Player* player, uint32& amount, Unit* victim)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnGiveXP(player, amount, victim);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnGiveXP, player, amount, victim);
 }
 
 void ScriptMgr::OnPlayerReputationChange(Player* player, uint32 factionID, int32& standing, bool incremental)
@@ -1885,27 +2048,27 @@ void ScriptMgr::OnPlayerDuelEnd(Player* winner, Player* loser, DuelCompleteType
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnChat, player, type, lang, msg);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Player* receiver)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, receiver);
+    FOREACH_SCRIPT_HOOK_ALIAS(PlayerScript, OnChat, OnWhisper, player, type, lang, msg, receiver);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Group* group)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, group);
+    FOREACH_SCRIPT_HOOK_ALIAS(PlayerScript, OnChat, OnGroupChat, player, type, lang, msg, group);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Guild* guild)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, guild);
+    FOREACH_SCRIPT_HOOK_ALIAS(PlayerScript, OnChat, OnGuildChat, player, type, lang, msg, guild);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Channel* channel)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, channel);
+    FOREACH_SCRIPT_HOOK_ALIAS(PlayerScript, OnChat, OnChannelChat, player, type, lang, msg, channel);
 }
 
 void ScriptMgr::OnPlayerEmote(Player* player, Emote emote)
@@ -1920,7 +2083,7 @@ void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emote
 
 void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnSpellCast(player, spell, skipCheck);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnSpellCast, player, spell, skipCheck);
 }
 
 void ScriptMgr::OnPlayerLogin(Player* player, bool firstLogin)
@@ -1960,7 +2123,7 @@ void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, ui
 
 void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newArea)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnUpdateZone(player, newZone, newArea);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnUpdateZone, player, newZone, newArea);
 }
 
 void ScriptMgr::OnQuestStatusChange(Player* player, uint32 questId)
@@ -2105,27 +2268,27 @@ void ScriptMgr::OnGroupDisband(Group* group)
 // Unit
 void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 {
-    FOREACH_SCRIPT(UnitScript)->OnHeal(healer, reciever, gain);
+    FOREACH_SCRIPT_HOOK(UnitScript, OnHeal, healer, reciever, gain);
 }
 
 void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->OnDamage(attacker, victim, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, OnDamage, attacker, victim, damage);
 }
 
 void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyPeriodicDamageAurasTick(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifyPeriodicDamageAurasTick, target, attacker, damage);
 }
 
 void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyMeleeDamage(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifyMeleeDamage, target, attacker, damage);
 }
 
 void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifySpellDamageTaken(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifySpellDamageTaken, target, attacker, damage);
 }
 
 SpellScriptLoader::SpellScriptLoader(char const* name)
@@ -2202,6 +2365,7 @@ void WorldScript::OnShutdownCancel()
 
 void WorldScript::OnUpdate(uint32 /*diff*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void WorldScript::OnStartup()
@@ -2366,22 +2530,27 @@ UnitScript::UnitScript(char const* name)
 
 void UnitScript::OnHeal(Unit* /*healer*/, Unit* /*reciever*/, uint32& /*gain*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void UnitScript::OnDamage(Unit* /*attacker*/, Unit* /*victim*/, uint32& /*damage*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void UnitScript::ModifyPeriodicDamageAurasTick(Unit* /*target*/, Unit* /*attacker*/, uint32& /*damage*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void UnitScript::ModifyMeleeDamage(Unit* /*target*/, Unit* /*attacker*/, uint32& /*damage*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void UnitScript::ModifySpellDamageTaken(Unit* /*target*/, Unit* /*attacker*/, int32& /*damage*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 CreatureScript::CreatureScript(char const* name)
@@ -2597,6 +2766,7 @@ void PlayerScript::OnTalentsReset(Player* /*player*/, bool /*involuntarily*/)
 
 void PlayerScript::OnMoneyChanged(Player* /*player*/, int32& /*amount*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnMoneyLimit(Player* /*player*/, int32 /*amount*/)
@@ -2605,6 +2775,7 @@ void PlayerScript::OnMoneyLimit(Player* /*player*/, int32 /*amount*/)
 
 void PlayerScript::OnGiveXP(Player* /*player*/, uint32& /*amount*/, Unit* /*victim*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnReputationChange(Player* /*player*/, uint32 /*factionId*/, int32& /*standing*/, bool /*incremental*/)
@@ -2625,22 +2796,27 @@ void PlayerScript::OnDuelEnd(Player* /*winner*/, Player* /*loser*/, DuelComplete
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Player* /*receiver*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Group* /*group*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Guild* /*guild*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Channel* /*channel*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnEmote(Player* /*player*/, Emote /*emote*/)
@@ -2653,6 +2829,7 @@ void PlayerScript::OnTextEmote(Player* /*player*/, uint32 /*textEmote*/, uint32
 
 void PlayerScript::OnSpellCast(Player* /*player*/, Spell* /*spell*/, bool /*skipCheck*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnLogin(Player* /*player*/, bool /*firstLogin*/)
@@ -2685,6 +2862,7 @@ void PlayerScript::OnBindToInstance(Player* /*player*/, Difficulty /*difficulty*
 
 void PlayerScript::OnUpdateZone(Player* /*player*/, uint32 /*newZone*/, uint32 /*newArea*/)
 {
+    ScriptHookNotOverridden = true;
 }
 
 void PlayerScript::OnMapChanged(Player* /*player*/)
@@ -0,0 +1,207 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "OpcodeProfiler.h"
+#include "Metric.h"
+#include "Opcodes.h"
+#include <algorithm>
+#include <array>
+
+struct OpcodeProfiler::ThreadStats
+{
+    struct Counters
+    {
+        std::atomic<uint64> Count;
+        std::atomic<uint64> TotalTime;
+        std::atomic<uint64> MaxTime;
+        std::atomic<uint64> Bytes;
+    };
+
+    // only the owning thread writes, so plain loads and stores are enough to stay free of data races
+    static void Add(std::atomic<uint64>& counter, uint64 value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    void Clear()
+    {
+        for (Counters& counters : ByOpcode)
+        {
+            counters.Count.store(0, std::memory_order_relaxed);
+            counters.TotalTime.store(0, std::memory_order_relaxed);
+            counters.MaxTime.store(0, std::memory_order_relaxed);
+            counters.Bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint32> Generation{ 0 };
+    bool InUse = false;
+    std::array<Counters, NUM_MSG_TYPES> ByOpcode{};
+};
+
+namespace
+{
+    // hands the counters of an exiting thread back so the next new thread reuses them
+    struct ThreadStatsHandle
+    {
+        ~ThreadStatsHandle()
+        {
+            if (Stats)
+                sOpcodeProfiler->ReleaseThreadStats(Stats);
+        }
+
+        OpcodeProfiler::ThreadStats* Stats = nullptr;
+    };
+
+    thread_local ThreadStatsHandle CurrentThreadStats;
+}
+
+OpcodeProfiler::OpcodeProfiler() : _enabled(false), _generation(0) { }
+
+OpcodeProfiler::~OpcodeProfiler() = default;
+
+OpcodeProfiler* OpcodeProfiler::instance()
+{
+    static OpcodeProfiler instance;
+    return &instance;
+}
+
+OpcodeProfiler::ThreadStats& OpcodeProfiler::GetThreadStats()
+{
+    if (CurrentThreadStats.Stats)
+        return *CurrentThreadStats.Stats;
+
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    auto itr = std::find_if(_threads.begin(), _threads.end(), [](std::unique_ptr<ThreadStats> const& stats) { return !stats->InUse; });
+    if (itr == _threads.end())
+    {
+        _threads.push_back(std::make_unique<ThreadStats>());
+        _threads.back()->Generation.store(_generation.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        itr = std::prev(_threads.end());
+    }
+
+    (*itr)->InUse = true;
+    CurrentThreadStats.Stats = itr->get();
+    return **itr;
+}
+
+void OpcodeProfiler::ReleaseThreadStats(ThreadStats* stats)
+{
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    stats->InUse = false;
+}
+
+void OpcodeProfiler::Record(uint32 opcode, std::chrono::nanoseconds elapsed, std::size_t bytes)
+{
+    if (opcode >= NUM_MSG_TYPES)
+        return;
+
+    ThreadStats& stats = GetThreadStats();
+    uint32 generation = _generation.load(std::memory_order_acquire);
+    if (stats.Generation.load(std::memory_order_relaxed) != generation)
+    {
+        stats.Clear();
+        stats.Generation.store(generation, std::memory_order_release);
+    }
+
+    uint64 time = uint64(std::max<std::chrono::nanoseconds::rep>(elapsed.count(), 0));
+    ThreadStats::Counters& counters = stats.ByOpcode[opcode];
+    ThreadStats::Add(counters.Count, 1);
+    ThreadStats::Add(counters.TotalTime, time);
+    ThreadStats::Add(counters.Bytes, bytes);
+    if (time > counters.MaxTime.load(std::memory_order_relaxed))
+        counters.MaxTime.store(time, std::memory_order_relaxed);
+}
+
+void OpcodeProfiler::Reset()
+{
+    std::lock_guard<std::mutex> lock(_threadsLock);
+    _generation.fetch_add(1, std::memory_order_release);
+    _exported.clear();
+}
+
+std::vector<OpcodeProfileEntry> OpcodeProfiler::Aggregate() const
+{
+    std::vector<OpcodeProfileEntry> totals(NUM_MSG_TYPES);
+    uint32 generation = _generation.load(std::memory_order_acquire);
+    for (std::unique_ptr<ThreadStats> const& stats : _threads)
+    {
+        // counters of an older generation are cleared by their thread before the next packet
+        if (stats->Generation.load(std::memory_order_acquire) != generation)
+            continue;
+
+        for (uint32 opcode = 0; opcode < NUM_MSG_TYPES; ++opcode)
+        {
+            ThreadStats::Counters const& counters = stats->ByOpcode[opcode];
+            OpcodeProfileEntry& total = totals[opcode];
+            total.Count += counters.Count.load(std::memory_order_relaxed);
+            total.TotalTime += counters.TotalTime.load(std::memory_order_relaxed);
+            total.MaxTime = std::max(total.MaxTime, counters.MaxTime.load(std::memory_order_relaxed));
+            total.Bytes += counters.Bytes.load(std::memory_order_relaxed);
+        }
+    }
+
+    for (uint32 opcode = 0; opcode < NUM_MSG_TYPES; ++opcode)
+        totals[opcode].Opcode = opcode;
+
+    return totals;
+}
+
+std::vector<OpcodeProfileEntry> OpcodeProfiler::GetStatistics() const
+{
+    std::vector<OpcodeProfileEntry> statistics;
+    {
+        std::lock_guard<std::mutex> lock(_threadsLock);
+        statistics = Aggregate();
+    }
+
+    std::erase_if(statistics, [](OpcodeProfileEntry const& entry) { return !entry.Count; });
+    std::sort(statistics.begin(), statistics.end(), [](OpcodeProfileEntry const& left, OpcodeProfileEntry const& right)
+    {
+        return left.TotalTime > right.TotalTime;
+    });
+    return statistics;
+}
+
+void OpcodeProfiler::LogMetrics()
+{
+    if (!IsEnabled())
+        return;
+
+    std::vector<OpcodeProfileEntry> current;
+    std::vector<OpcodeProfileEntry> previous;
+    {
+        std::lock_guard<std::mutex> lock(_threadsLock);
+        current = Aggregate();
+        previous = std::exchange(_exported, current);
+    }
+
+    if (previous.empty())
+        previous.resize(current.size());
+
+    for (OpcodeProfileEntry const& entry : current)
+    {
+        OpcodeProfileEntry const& last = previous[entry.Opcode];
+        if (entry.Count <= last.Count)
+            continue;
+
+        char const* name = opcodeTable[static_cast<Opcodes>(entry.Opcode)]->Name;
+        TC_METRIC_VALUE("opcode_handler_calls", entry.Count - last.Count, TC_METRIC_TAG("opcode", name));
+        TC_METRIC_VALUE("opcode_handler_time", (entry.TotalTime - last.TotalTime) / 1000, TC_METRIC_TAG("opcode", name));
+        TC_METRIC_VALUE("opcode_handler_bytes", entry.Bytes - last.Bytes, TC_METRIC_TAG("opcode", name));
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_OPCODEPROFILER_H
+#define TRINITY_OPCODEPROFILER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct OpcodeProfileEntry
+{
+    uint32 Opcode = 0;
+    uint64 Count = 0;
+    uint64 TotalTime = 0;   // nanoseconds
+    uint64 MaxTime = 0;     // nanoseconds
+    uint64 Bytes = 0;
+};
+
+/*
+ * Counts calls, handler time and packet bytes of every client opcode.
+ * Each thread that handles packets writes only to its own counters, without locks or atomic read-modify-write,
+ * readers sum the counters of all threads. Reset bumps a generation that every thread applies to its own counters
+ * before recording the next packet.
+ */
+class TC_GAME_API OpcodeProfiler
+{
+    private:
+        OpcodeProfiler();
+        ~OpcodeProfiler();
+
+    public:
+        struct ThreadStats;
+
+        static OpcodeProfiler* instance();
+
+        bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+        void SetEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+        void Record(uint32 opcode, std::chrono::nanoseconds elapsed, std::size_t bytes);
+        void Reset();
+
+        // Totals since the last reset of all opcodes that were handled at least once, most expensive first
+        std::vector<OpcodeProfileEntry> GetStatistics() const;
+
+        // Sends what was handled since the previous call to the metric database
+        void LogMetrics();
+
+        // Called when a thread exits, its counters are kept and handed to the next new thread
+        void ReleaseThreadStats(ThreadStats* stats);
+
+    private:
+        ThreadStats& GetThreadStats();
+        std::vector<OpcodeProfileEntry> Aggregate() const;
+
+        std::atomic<bool> _enabled;
+        std::atomic<uint32> _generation;
+
+        mutable std::mutex _threadsLock;
+        std::vector<std::unique_ptr<ThreadStats>> _threads;
+        std::vector<OpcodeProfileEntry> _exported;
+};
+
+#define sOpcodeProfiler OpcodeProfiler::instance()
+
+#endif
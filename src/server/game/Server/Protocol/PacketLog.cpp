@@ -18,8 +18,12 @@
 #include "PacketLog.h"
 #include "Config.h"
 #include "IpAddress.h"
+#include "Log.h"
+#include "StringConvert.h"
 #include "Timer.h"
+#include "Util.h"
 #include "WorldPacket.h"
+#include <cctype>
 
 #pragma pack(push, 1)
 
@@ -57,13 +61,53 @@ struct PacketHeader
 
 #pragma pack(pop)
 
-PacketLog::PacketLog() : _file(nullptr)
+struct PacketLogRecord
+{
+    PacketHeader Header;
+    std::vector<uint8> Contents;
+};
+
+namespace
+{
+    constexpr std::size_t FileBufferSize = 1024 * 1024;
+
+    std::size_t GetRecordSize(std::size_t packetSize)
+    {
+        return sizeof(PacketHeader) + packetSize;
+    }
+
+    template<typename Callback>
+    void ForEachConfigListEntry(char const* option, Callback&& callback)
+    {
+        std::string value = sConfigMgr->GetStringDefault(option, "");
+        for (std::string_view token : Trinity::Tokenize(value, ',', false))
+        {
+            while (!token.empty() && std::isspace(static_cast<unsigned char>(token.front())))
+                token.remove_prefix(1);
+            while (!token.empty() && std::isspace(static_cast<unsigned char>(token.back())))
+                token.remove_suffix(1);
+
+            if (Optional<uint32> entry = Trinity::StringTo<uint32>(token, 0))
+                callback(*entry);
+            else
+                TC_LOG_ERROR("server.loading", "{}: '{}' is not a valid number, ignored.", option, token);
+        }
+    }
+}
+
+PacketLog::PacketLog() : _file(nullptr), _pendingBytes(0), _maxPendingBytes(0), _droppedPackets(0), _stopWriter(false)
 {
     std::call_once(_initializeFlag, &PacketLog::Initialize, this);
 }
 
 PacketLog::~PacketLog()
 {
+    if (_writerThread.joinable())
+    {
+        _stopWriter.store(true, std::memory_order_release);
+        _writerThread.join();
+    }
+
     if (_file)
         fclose(_file);
 
@@ -101,15 +145,86 @@ void PacketLog::Initialize()
         header.OptionalDataSize = 0;
 
         if (CanLogPacket())
+        {
+            _fileBuffer = std::make_unique<char[]>(FileBufferSize);
+            setvbuf(_file, _fileBuffer.get(), _IOFBF, FileBufferSize);
+
             fwrite(&header, sizeof(header), 1, _file);
+
+            _maxPendingBytes = uint64(sConfigMgr->GetIntDefault("PacketLog.MaxPendingSize", 64)) * 1024 * 1024;
+            LoadFilters();
+
+            _writerThread = std::thread(&PacketLog::WriteRecords, this);
+        }
     }
 }
 
-void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port)
+void PacketLog::LoadFilters()
+{
+    std::shared_ptr<PacketLogFilter> filter = std::make_shared<PacketLogFilter>();
+    ForEachConfigListEntry("PacketLog.AccountIds", [&](uint32 accountId) { filter->AccountIds.insert(accountId); });
+    ForEachConfigListEntry("PacketLog.Opcodes", [&](uint32 opcode) { filter->Opcodes.insert(opcode); });
+
+    if (filter->AccountIds.empty() && filter->Opcodes.empty())
+        filter.reset();
+
+    _filter.store(std::move(filter), std::memory_order_release);
+}
+
+void PacketLog::WriteRecords()
 {
-    std::lock_guard<std::mutex> lock(_logPacketLock);
+    uint64 reportedDrops = 0;
+    while (true)
+    {
+        // read before draining, so nothing queued before the stop request is lost
+        bool stop = _stopWriter.load(std::memory_order_acquire);
+
+        bool written = false;
+        PacketLogRecord* record;
+        while (_queue.Dequeue(record))
+        {
+            fwrite(&record->Header, sizeof(record->Header), 1, _file);
+            if (!record->Contents.empty())
+                fwrite(record->Contents.data(), 1, record->Contents.size(), _file);
+
+            _pendingBytes.fetch_sub(GetRecordSize(record->Contents.size()), std::memory_order_relaxed);
+            delete record;
+            written = true;
+        }
+
+        if (written)
+            fflush(_file);
+
+        uint64 dropped = _droppedPackets.load(std::memory_order_relaxed);
+        if (dropped != reportedDrops)
+        {
+            TC_LOG_WARN("network", "PacketLog: writer can't keep up, {} packets dropped so far.", dropped);
+            reportedDrops = dropped;
+        }
+
+        if (stop)
+            break;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, uint32 accountId)
+{
+    if (std::shared_ptr<PacketLogFilter const> filter = _filter.load(std::memory_order_acquire))
+        if (!filter->Matches(accountId, packet.GetOpcode()))
+            return;
+
+    std::size_t recordSize = GetRecordSize(packet.size());
+    if (_pendingBytes.fetch_add(recordSize, std::memory_order_relaxed) + recordSize > _maxPendingBytes)
+    {
+        _pendingBytes.fetch_sub(recordSize, std::memory_order_relaxed);
+        _droppedPackets.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
-    PacketHeader header;
+    PacketLogRecord* record = new PacketLogRecord();
+    PacketHeader& header = record->Header;
     header.Direction = direction == CLIENT_TO_SERVER ? 0x47534d43 : 0x47534d53;
     header.ConnectionId = 0;
     header.ArrivalTicks = getMSTime();
@@ -131,9 +246,8 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
     header.Length = packet.size() + sizeof(header.Opcode);
     header.Opcode = packet.GetOpcode();
 
-    fwrite(&header, sizeof(header), 1, _file);
     if (!packet.empty())
-        fwrite(packet.contents(), 1, packet.size(), _file);
+        record->Contents.assign(packet.contents(), packet.contents() + packet.size());
 
-    fflush(_file);
+    _queue.Enqueue(record);
 }
@@ -19,9 +19,14 @@
 #define TRINITY_PACKETLOG_H
 
 #include "Common.h"
+#include "MPSCQueue.h"
 
 #include <boost/asio/ip/address.hpp>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_set>
 
 enum Direction
 {
@@ -30,24 +35,57 @@ enum Direction
 };
 
 class WorldPacket;
+struct PacketLogRecord;
 
+// Restricts logging to some accounts or opcodes, an empty set lets everything through
+struct PacketLogFilter
+{
+    std::unordered_set<uint32> AccountIds;
+    std::unordered_set<uint32> Opcodes;
+
+    bool Matches(uint32 accountId, uint32 opcode) const
+    {
+        return (AccountIds.empty() || AccountIds.count(accountId)) && (Opcodes.empty() || Opcodes.count(opcode));
+    }
+};
+
+/*
+ * Packets are copied into records and queued without locking,
+ * a background thread writes them to the file in large buffered batches.
+ * When the writer falls behind by more than PacketLog.MaxPendingSize packets are dropped and counted.
+ */
 class TC_GAME_API PacketLog
 {
     private:
         PacketLog();
         ~PacketLog();
-        std::mutex _logPacketLock;
         std::once_flag _initializeFlag;
 
     public:
         static PacketLog* instance();
 
         void Initialize();
+        // Reads the account and opcode filters, called again when the config is reloaded
+        void LoadFilters();
         bool CanLogPacket() const { return (_file != nullptr); }
-        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port);
+        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, uint32 accountId);
+
+        uint64 GetDroppedPacketCount() const { return _droppedPackets.load(std::memory_order_relaxed); }
 
     private:
+        void WriteRecords();
+
         FILE* _file;
+        std::unique_ptr<char[]> _fileBuffer;
+        std::atomic<std::shared_ptr<PacketLogFilter const>> _filter;
+
+        MPSCQueue<PacketLogRecord> _queue;
+        std::atomic<uint64> _pendingBytes;
+        uint64 _maxPendingBytes;
+        std::atomic<uint64> _droppedPackets;
+
+        std::atomic<bool> _stopWriter;
+        std::thread _writerThread;
 };
 
 #define sPacketLog PacketLog::instance()
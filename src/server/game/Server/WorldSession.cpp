@@ -41,6 +41,7 @@
 #include "MoveSpline.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "OpcodeProfiler.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "PacketUtilities.h"
@@ -73,7 +74,7 @@ bool MapSessionFilter::Process(WorldPacket* packet)
         return true;
 
     //we do not process thread-unsafe packets
-    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
+    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE || opHandle->ProcessingPlace == PROCESS_SESSIONLOCAL)
         return false;
 
     Player* player = m_pSession->GetPlayer();
@@ -95,7 +96,7 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
         return true;
 
     //thread-unsafe packets should be processed in World::UpdateSessions()
-    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
+    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE || opHandle->ProcessingPlace == PROCESS_SESSIONLOCAL)
         return true;
 
     //no player attached? -> our client! ^^
@@ -107,6 +108,14 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return (player->IsInWorld() == false);
 }
 
+//session update workers only process packets which do not touch shared world state
+bool DetachedSessionFilter::Process(WorldPacket* packet)
+{
+    ClientOpcodeHandler const* opHandle = opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())];
+
+    return opHandle->ProcessingPlace == PROCESS_SESSIONLOCAL;
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldSocket> sock, AccountTypes sec, uint8 expansion, time_t mute_time,
     Minutes timezoneOffset, LocaleConstant locale, uint32 recruiter, bool isARecruiter):
@@ -123,6 +132,7 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _logoutTime(0),
     m_inQueue(false),
     m_playerLoading(false),
+    m_playerLoginStart(),
     m_playerLogout(false),
     m_playerRecentlyLogout(false),
     m_playerSave(false),
@@ -142,6 +152,7 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _pendingTimeSyncRequests(),
     _timeSyncNextCounter(0),
     _timeSyncTimer(0),
+    _detachedProcessedPackets(0),
     _calendarEventCreationCooldown(0),
     _gameClient(new GameClient(this))
 {
@@ -276,13 +287,29 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
     packet->print_storage();
 }
 
+void WorldSession::CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet)
+{
+    if (!sOpcodeProfiler->IsEnabled())
+    {
+        opHandle->Call(this, packet);
+        return;
+    }
+
+    // handlers may consume or rewrite the packet, remember what arrived
+    uint32 opcode = packet.GetOpcode();
+    std::size_t size = packet.size();
+    TimePoint start = std::chrono::steady_clock::now();
+    opHandle->Call(this, packet);
+    sOpcodeProfiler->Record(opcode, std::chrono::steady_clock::now() - start, size);
+}
+
 /// Update the WorldSession (triggered by World update)
 bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 {
     ///- Before we process anything:
     /// If necessary, kick the player because the client didn't send anything for too long
     /// (or they've been idling in character select)
-    if (IsConnectionIdle() && !HasPermission(rbac::RBAC_PERM_IGNORE_IDLE_CONNECTION))
+    if (updater.ProcessUnsafe() && IsConnectionIdle() && !HasPermission(rbac::RBAC_PERM_IGNORE_IDLE_CONNECTION))
         m_Socket->CloseSocket();
 
     ///- Retrieve packets from the receive queue and call the appropriate handlers
@@ -291,7 +318,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     //! Delete packet after processing by default
     bool deletePacket = true;
     std::vector<WorldPacket*> requeuePackets;
-    uint32 processedPackets = 0;
+    // the detached pass and the serial pass share a single packet budget per tick
+    uint32 processedPackets = std::exchange(_detachedProcessedPackets, 0);
     time_t currentTime = GameTime::GetGameTime();
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 100;
@@ -325,7 +353,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         if(AntiDOS.EvaluateOpcode(*packet, currentTime))
                         {
                             sScriptMgr->OnPacketReceive(this, *packet);
-                            opHandle->Call(this, *packet);
+                            CallOpcodeHandler(opHandle, *packet);
                             LogUnprocessedTail(packet);
                         }
                         else
@@ -341,7 +369,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     {
                         // not expected _player or must checked in packet hanlder
                         sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        CallOpcodeHandler(opHandle, *packet);
                         LogUnprocessedTail(packet);
                     }
                     else
@@ -355,7 +383,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     else if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                     {
                         sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        CallOpcodeHandler(opHandle, *packet);
                         LogUnprocessedTail(packet);
                     }
                     else
@@ -377,7 +405,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                     {
                         sScriptMgr->OnPacketReceive(this, *packet);
-                        opHandle->Call(this, *packet);
+                        CallOpcodeHandler(opHandle, *packet);
                         LogUnprocessedTail(packet);
                     }
                     else
@@ -434,10 +462,19 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             break;
     }
 
-    TC_METRIC_VALUE("processed_packets", processedPackets);
-
     _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
 
+    _sessionLocalQueryProcessor.ProcessReadyCallbacks();
+
+    //remaining query callbacks may touch shared world state, leave them (and the timers) to World::UpdateSessions()
+    if (!updater.ProcessCallbacks())
+    {
+        _detachedProcessedPackets = processedPackets;
+        return true;
+    }
+
+    TC_METRIC_VALUE("processed_packets", processedPackets);
+
     if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
     {
         // Send time sync packet every 10s.
@@ -37,6 +37,7 @@
 #include <memory>
 #include <unordered_map>
 
+class ClientOpcodeHandler;
 class Creature;
 class GameClient;
 class GameObject;
@@ -357,6 +358,7 @@ public:
 
     virtual bool Process(WorldPacket* /*packet*/) { return true; }
     virtual bool ProcessUnsafe() const { return true; }
+    virtual bool ProcessCallbacks() const { return true; }
 
 protected:
     WorldSession* const m_pSession;
@@ -388,6 +390,20 @@ public:
     virtual bool Process(WorldPacket* packet) override;
 };
 
+//process only session local packets of sessions that are not on a map
+//used by WorldSessionUpdater worker threads before World::UpdateSessions() runs its serial pass
+class DetachedSessionFilter : public PacketFilter
+{
+public:
+    explicit DetachedSessionFilter(WorldSession* pSession) : PacketFilter(pSession) { }
+    ~DetachedSessionFilter() { }
+
+    virtual bool Process(WorldPacket* packet) override;
+    //logout, timers and query callbacks are handled by World::UpdateSessions()
+    virtual bool ProcessUnsafe() const override { return false; }
+    virtual bool ProcessCallbacks() const override { return false; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class CharacterCreateInfo
@@ -1199,6 +1215,8 @@ class TC_GAME_API WorldSession
         void ProcessQueryCallbacks();
 
         QueryCallbackProcessor _queryProcessor;
+        // callbacks that only touch this session (and thread safe caches), processed on session update workers too
+        QueryCallbackProcessor _sessionLocalQueryProcessor;
         AsyncCallbackProcessor<TransactionCallback> _transactionCallbacks;
         AsyncCallbackProcessor<SQLQueryHolderCallback> _queryHolderProcessor;
 
@@ -1242,6 +1260,9 @@ class TC_GAME_API WorldSession
         void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char *reason);
         void LogUnprocessedTail(WorldPacket* packet);
 
+        // runs the handler, timed by the opcode profiler when it is enabled
+        void CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet);
+
         // EnumData helpers
         bool IsLegitCharacterForAccount(ObjectGuid lowGUID)
         {
@@ -1272,6 +1293,7 @@ class TC_GAME_API WorldSession
         time_t _logoutTime;
         bool m_inQueue;                                     // session wait in auth.queue
         bool m_playerLoading;                               // code processed in LoginPlayer
+        TimePoint m_playerLoginStart;                       // login request received, for login latency metrics
         bool m_playerLogout;                                // code processed in LogoutPlayer
         bool m_playerRecentlyLogout;
         bool m_playerSave;
@@ -1321,6 +1343,7 @@ class TC_GAME_API WorldSession
         std::map<uint32, uint32> _pendingTimeSyncRequests; // key: counter. value: server time when packet with that counter was sent.
         uint32 _timeSyncNextCounter;
         uint32 _timeSyncTimer;
+        uint32 _detachedProcessedPackets;
 
         // Packets cooldown
         time_t _calendarEventCreationCooldown;
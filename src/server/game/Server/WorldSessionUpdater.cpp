@@ -0,0 +1,123 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldSessionUpdater.h"
+#include "DatabaseEnv.h"
+#include "WorldSession.h"
+#include <algorithm>
+
+class WorldSessionUpdateRequest
+{
+    public:
+        WorldSessionUpdateRequest(WorldSessionUpdater& updater, WorldSession* const* begin, WorldSession* const* end, uint32 diff)
+            : _updater(updater), _begin(begin), _end(end), _diff(diff) { }
+
+        void Call()
+        {
+            for (WorldSession* const* itr = _begin; itr != _end; ++itr)
+            {
+                DetachedSessionFilter filter(*itr);
+                (*itr)->Update(_diff, filter);
+            }
+
+            _updater.UpdateFinished();
+        }
+
+    private:
+        WorldSessionUpdater& _updater;
+        WorldSession* const* _begin;
+        WorldSession* const* _end;
+        uint32 _diff;
+};
+
+void WorldSessionUpdater::Activate(size_t numThreads)
+{
+    for (size_t i = 0; i < numThreads; ++i)
+        _workerThreads.emplace_back(&WorldSessionUpdater::WorkerThread, this);
+}
+
+void WorldSessionUpdater::Deactivate()
+{
+    _cancelationToken = true;
+
+    Wait();
+
+    _queue.Cancel();
+
+    for (std::thread& thread : _workerThreads)
+        thread.join();
+
+    _workerThreads.clear();
+}
+
+void WorldSessionUpdater::Wait()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+
+    while (_pendingRequests > 0)
+        _condition.wait(lock);
+}
+
+void WorldSessionUpdater::ScheduleUpdate(std::vector<WorldSession*> const& sessions, uint32 diff)
+{
+    if (sessions.empty())
+        return;
+
+    size_t const batchCount = std::min(_workerThreads.size(), sessions.size());
+    size_t const batchSize = (sessions.size() + batchCount - 1) / batchCount;
+
+    std::lock_guard<std::mutex> lock(_lock);
+
+    for (size_t begin = 0; begin < sessions.size(); begin += batchSize)
+    {
+        size_t end = std::min(begin + batchSize, sessions.size());
+
+        ++_pendingRequests;
+
+        _queue.Push(new WorldSessionUpdateRequest(*this, sessions.data() + begin, sessions.data() + end, diff));
+    }
+}
+
+void WorldSessionUpdater::UpdateFinished()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    --_pendingRequests;
+
+    _condition.notify_all();
+}
+
+void WorldSessionUpdater::WorkerThread()
+{
+    LoginDatabase.WarnAboutSyncQueries(true);
+    CharacterDatabase.WarnAboutSyncQueries(true);
+    WorldDatabase.WarnAboutSyncQueries(true);
+
+    while (true)
+    {
+        WorldSessionUpdateRequest* request = nullptr;
+
+        _queue.WaitAndPop(request);
+
+        if (_cancelationToken)
+            return;
+
+        request->Call();
+
+        delete request;
+    }
+}
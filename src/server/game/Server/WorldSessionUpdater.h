@@ -0,0 +1,69 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WorldSessionUpdater_h__
+#define WorldSessionUpdater_h__
+
+#include "Define.h"
+#include "ProducerConsumerQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorldSession;
+class WorldSessionUpdateRequest;
+
+/// Worker pool updating sessions that are not on a map (character selection, loading, queue)
+/// Only PROCESS_SESSIONLOCAL packets are handled here, everything touching shared world state
+/// (query callbacks, logout, thread-unsafe opcodes) stays in World::UpdateSessions()
+class TC_GAME_API WorldSessionUpdater
+{
+    public:
+        WorldSessionUpdater() : _cancelationToken(false), _pendingRequests(0) { }
+        ~WorldSessionUpdater() { }
+
+        friend class WorldSessionUpdateRequest;
+
+        /// Splits sessions into one batch per worker thread, sessions must stay valid until Wait() returns
+        void ScheduleUpdate(std::vector<WorldSession*> const& sessions, uint32 diff);
+
+        void Wait();
+
+        void Activate(size_t numThreads);
+
+        void Deactivate();
+
+        bool Activated() const { return !_workerThreads.empty(); }
+
+    private:
+        ProducerConsumerQueue<WorldSessionUpdateRequest*> _queue;
+
+        std::vector<std::thread> _workerThreads;
+        std::atomic<bool> _cancelationToken;
+
+        std::mutex _lock;
+        std::condition_variable _condition;
+        size_t _pendingRequests;
+
+        void UpdateFinished();
+
+        void WorkerThread();
+};
+
+#endif // WorldSessionUpdater_h__
@@ -121,6 +121,7 @@ private:
     std::mutex _worldSessionLock;
     WorldSession* _worldSession;
     bool _authed;
+    std::atomic<uint32> _accountId;                         // for packet log filters, packets can be sent from any thread
 
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
@@ -48,6 +48,8 @@ AuraCreateInfo::AuraCreateInfo(SpellInfo const* spellInfo, uint8 auraEffMask, Wo
     ASSERT(auraEffMask <= MAX_EFFECT_MASK);
 }
 
+TC_DEFINE_POOLED_ALLOCATION(AuraApplication)
+
 AuraApplication::AuraApplication(Unit* target, Unit* caster, Aura* aura, uint8 effMask) :
 _target(target), _base(aura), _removeMode(AURA_REMOVE_NONE), _slot(MAX_AURAS),
 _flags(AFLAG_NONE), _effectsToApply(effMask), _needClientUpdate(false)
@@ -2559,6 +2561,8 @@ std::string Aura::GetDebugInfo() const
     return sstr.str();
 }
 
+TC_DEFINE_POOLED_ALLOCATION(UnitAura)
+
 UnitAura::UnitAura(AuraCreateInfo const& createInfo)
     : Aura(createInfo)
 {
@@ -2695,6 +2699,8 @@ void UnitAura::AddStaticApplication(Unit* target, uint8 effMask)
     _staticApplications[target->GetGUID()] |= effMask;
 }
 
+TC_DEFINE_POOLED_ALLOCATION(DynObjAura)
+
 DynObjAura::DynObjAura(AuraCreateInfo const& createInfo)
     : Aura(createInfo)
 {
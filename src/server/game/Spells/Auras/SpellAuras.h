@@ -18,6 +18,7 @@
 #ifndef TRINITY_SPELLAURAS_H
 #define TRINITY_SPELLAURAS_H
 
+#include "ObjectPool.h"
 #include "SpellAuraDefines.h"
 #include "SpellInfo.h"
 #include "UniqueTrackablePtr.h"
@@ -63,6 +64,8 @@ class TC_GAME_API AuraApplication
         void _HandleEffect(uint8 effIndex, bool apply);
 
     public:
+        TC_DECLARE_POOLED_ALLOCATION();
+
         Unit* GetTarget() const { return _target; }
         Aura* GetBase() const { return _base; }
 
@@ -322,6 +325,8 @@ class TC_GAME_API UnitAura : public Aura
     protected:
         explicit UnitAura(AuraCreateInfo const& createInfo);
     public:
+        TC_DECLARE_POOLED_ALLOCATION();
+
         void _ApplyForTarget(Unit* target, Unit* caster, AuraApplication* aurApp) override;
         void _UnapplyForTarget(Unit* target, Unit* caster, AuraApplication* aurApp) override;
 
@@ -346,6 +351,8 @@ class TC_GAME_API DynObjAura : public Aura
     protected:
         explicit DynObjAura(AuraCreateInfo const& createInfo);
     public:
+        TC_DECLARE_POOLED_ALLOCATION();
+
         void Remove(AuraRemoveMode removeMode = AURA_REMOVE_BY_DEFAULT) override;
 
         void FillTargetMap(std::unordered_map<Unit*, uint8>& targets, Unit* caster) override;
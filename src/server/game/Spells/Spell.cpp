@@ -493,6 +493,8 @@ public:
     explicit SpellEvent(Spell* spell);
     ~SpellEvent();
 
+    TC_DECLARE_POOLED_ALLOCATION();
+
     bool Execute(uint64 e_time, uint32 p_time) override;
     void Abort(uint64 e_time) override;
     bool IsDeletable() const override;
@@ -505,6 +507,9 @@ protected:
     Trinity::unique_trackable_ptr<Spell> m_Spell;
 };
 
+TC_DEFINE_POOLED_ALLOCATION(Spell)
+TC_DEFINE_POOLED_ALLOCATION(SpellEvent)
+
 Spell::Spell(WorldObject* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID) :
 m_spellInfo(sSpellMgr->GetSpellForDifficultyFromSpell(info, caster)),
 m_caster((info->HasAttribute(SPELL_ATTR6_CAST_BY_CHARMER) && caster->GetCharmerOrOwner()) ? caster->GetCharmerOrOwner() : caster)
@@ -1207,7 +1212,8 @@ void Spell::SelectImplicitConeTargets(SpellEffectInfo const& spellEffectInfo, Sp
         ABORT_MSG("Spell::SelectImplicitConeTargets: received not implemented target reference type");
         return;
     }
-    std::list<WorldObject*> targets;
+    ScratchBufferPool<WorldObject*>::Lease targetsBuffer = m_caster->GetMap()->GetObjectBufferPool().Acquire();
+    std::vector<WorldObject*>& targets = *targetsBuffer;
     SpellTargetObjectTypes objectType = targetType.GetObjectType();
     SpellTargetCheckTypes selectionType = targetType.GetCheckType();
     ConditionContainer* condList = spellEffectInfo.ImplicitTargetConditions;
@@ -1239,6 +1245,7 @@ void Spell::SelectImplicitConeTargets(SpellEffectInfo const& spellEffectInfo, Sp
                 Trinity::Containers::RandomResize(targets, maxTargets);
             }
 
+            m_UniqueTargetInfo.reserve(m_UniqueTargetInfo.size() + targets.size());
             for (WorldObject* itr : targets)
             {
                 if (Unit* unit = itr->ToUnit())
@@ -1303,7 +1310,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffectInfo const& spellEffectInfo, Sp
              ABORT_MSG("Spell::SelectImplicitAreaTargets: received not implemented target reference type");
              return;
     }
-    std::list<WorldObject*> targets;
+    ScratchBufferPool<WorldObject*>::Lease targetsBuffer = m_caster->GetMap()->GetObjectBufferPool().Acquire();
+    std::vector<WorldObject*>& targets = *targetsBuffer;
     float radius = spellEffectInfo.CalcRadius(m_caster);
     // Workaround for some spells that don't have RadiusEntry set in dbc (but SpellRange instead)
     if (G3D::fuzzyEq(radius, 0.f))
@@ -1325,10 +1333,36 @@ void Spell::SelectImplicitAreaTargets(SpellEffectInfo const& spellEffectInfo, Sp
             Trinity::Containers::RandomResize(targets, maxTargets);
         }
 
+        // line of sight from the area center does not depend on the effect, test all unit targets at once
+        std::vector<Optional<bool>> inLineOfSight(targets.size());
+        if (targets.size() > 1 && !IsLineOfSightCheckIgnored())
+        {
+            std::vector<VMAP::LineOfSightQuery> queries;
+            std::vector<std::size_t> queryTargets;
+            std::size_t index = 0;
+            for (WorldObject* itr : targets)
+            {
+                VMAP::LineOfSightQuery query;
+                if (itr->ToUnit() && itr->BuildLineOfSightQuery(center->GetPositionX(), center->GetPositionY(), center->GetPositionZ(), query))
+                {
+                    queries.push_back(query);
+                    queryTargets.push_back(index);
+                }
+                ++index;
+            }
+
+            m_caster->GetMap()->isInLineOfSight(queries, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2);
+            for (std::size_t i = 0; i < queries.size(); ++i)
+                inLineOfSight[queryTargets[i]] = queries[i].InLineOfSight;
+        }
+
+        m_UniqueTargetInfo.reserve(m_UniqueTargetInfo.size() + targets.size());
+        std::size_t index = 0;
         for (WorldObject* itr : targets)
         {
+            Optional<bool> targetInLineOfSight = inLineOfSight[index++];
             if (Unit* unit = itr->ToUnit())
-                AddUnitTarget(unit, effMask, false, true, center);
+                AddUnitTarget(unit, effMask, false, true, center, targetInLineOfSight);
             else if (GameObject* gObjTarget = itr->ToGameObject())
                 AddGOTarget(gObjTarget, effMask);
             else if (Corpse* corpse = itr->ToCorpse())
@@ -1617,15 +1651,16 @@ void Spell::SelectImplicitChainTargets(SpellEffectInfo const& spellEffectInfo, S
                 m_damageMultipliers[k] = 1.0f;
         m_applyMultiplierMask |= effMask;
 
-        std::list<WorldObject*> targets;
+        ScratchBufferPool<WorldObject*>::Lease targetsBuffer = m_caster->GetMap()->GetObjectBufferPool().Acquire();
+        std::vector<WorldObject*>& targets = *targetsBuffer;
         SearchChainTargets(targets, maxTargets - 1, target, targetType.GetObjectType(), targetType.GetCheckType()
             , spellEffectInfo.ImplicitTargetConditions, targetType.GetTarget() == TARGET_UNIT_TARGET_CHAINHEAL_ALLY);
 
         // Chain primary target is added earlier
         CallScriptObjectAreaTargetSelectHandlers(targets, spellEffectInfo.EffectIndex, targetType);
 
-        for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
-            if (Unit* unit = (*itr)->ToUnit())
+        for (WorldObject* chainTarget : targets)
+            if (Unit* unit = chainTarget->ToUnit())
                 AddUnitTarget(unit, effMask, false);
     }
 }
@@ -1655,15 +1690,14 @@ void Spell::SelectImplicitTrajTargets(SpellEffectInfo const& spellEffectInfo, Sp
     srcPos.SetOrientation(m_caster->GetOrientation());
     float srcToDestDelta = m_targets.GetDstPos()->m_positionZ - srcPos.m_positionZ;
 
-    std::list<WorldObject*> targets;
+    ScratchBufferPool<WorldObject*>::Lease targetsBuffer = m_caster->GetMap()->GetObjectBufferPool().Acquire();
+    std::vector<WorldObject*>& targets = *targetsBuffer;
     Trinity::WorldObjectSpellTrajTargetCheck check(dist2d, &srcPos, m_caster, m_spellInfo, targetType.GetCheckType(), spellEffectInfo.ImplicitTargetConditions);
     Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellTrajTargetCheck> searcher(m_caster, targets, check, GRID_MAP_TYPE_MASK_ALL);
     SearchTargets<Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellTrajTargetCheck> > (searcher, GRID_MAP_TYPE_MASK_ALL, m_caster, &srcPos, dist2d);
     if (targets.empty())
         return;
 
-    targets.sort(Trinity::ObjectDistanceOrderPred(m_caster));
-
     float b = tangent(m_targets.GetElevation());
     float a = (srcToDestDelta - dist2d * b) / (dist2d * dist2d);
     if (a > -0.0001f)
@@ -1677,14 +1711,21 @@ void Spell::SelectImplicitTrajTargets(SpellEffectInfo const& spellEffectInfo, Sp
 
     // GameObjects don't cast traj
     Unit* unitCaster = ASSERT_NOTNULL(m_caster->ToUnit());
-    for (auto itr = targets.begin(); itr != targets.end(); ++itr)
+
+    // targets are checked closest first until the first hit, so only order as many as needed
+    auto fartherFirst = [this](WorldObject const* left, WorldObject const* right) { return m_caster->GetDistanceOrder(right, left); };
+    std::make_heap(targets.begin(), targets.end(), fartherFirst);
+    for (auto heapEnd = targets.end(); heapEnd != targets.begin(); --heapEnd)
     {
-        if (m_spellInfo->CheckTarget(unitCaster, *itr, true) != SPELL_CAST_OK)
+        std::pop_heap(targets.begin(), heapEnd, fartherFirst);
+        WorldObject* target = *(heapEnd - 1);
+
+        if (m_spellInfo->CheckTarget(unitCaster, target, true) != SPELL_CAST_OK)
             continue;
 
-        if (Unit* unit = (*itr)->ToUnit())
+        if (Unit* unit = target->ToUnit())
         {
-            if (unitCaster == *itr || unitCaster->IsOnVehicle(unit) || unit->GetVehicle())
+            if (unitCaster == target || unitCaster->IsOnVehicle(unit) || unit->GetVehicle())
                 continue;
 
             if (Creature* creatureTarget = unit->ToCreature())
@@ -1694,13 +1735,13 @@ void Spell::SelectImplicitTrajTargets(SpellEffectInfo const& spellEffectInfo, Sp
             }
         }
 
-        float const size = std::max((*itr)->GetCombatReach(), 1.0f);
-        float const objDist2d = srcPos.GetExactDist2d(*itr);
-        float const dz = (*itr)->GetPositionZ() - srcPos.m_positionZ;
+        float const size = std::max(target->GetCombatReach(), 1.0f);
+        float const objDist2d = srcPos.GetExactDist2d(target);
+        float const dz = target->GetPositionZ() - srcPos.m_positionZ;
 
-        float const horizontalDistToTraj = std::fabs(objDist2d * std::sin(srcPos.GetRelativeAngle(*itr)));
+        float const horizontalDistToTraj = std::fabs(objDist2d * std::sin(srcPos.GetRelativeAngle(target)));
         float const sizeFactor = std::cos((horizontalDistToTraj / size) * (M_PI / 2.0f));
-        float const distToHitPoint = std::max(objDist2d * std::cos(srcPos.GetRelativeAngle(*itr)) - size * sizeFactor, 0.0f);
+        float const distToHitPoint = std::max(objDist2d * std::cos(srcPos.GetRelativeAngle(target)) - size * sizeFactor, 0.0f);
         float const height = distToHitPoint * (a * distToHitPoint + b);
 
         if (fabs(dz - height) > size + b / 2.0f + TRAJECTORY_MISSILE_SIZE)
@@ -1899,7 +1940,7 @@ WorldObject* Spell::SearchNearbyTarget(float range, SpellTargetObjectTypes objec
     return target;
 }
 
-void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, WorldObject* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionContainer* condList)
+void Spell::SearchAreaTargets(std::vector<WorldObject*>& targets, float range, Position const* position, WorldObject* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionContainer* condList)
 {
     uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList);
     if (!containerTypeMask)
@@ -1912,7 +1953,7 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Pos
     SearchTargets<Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellAreaTargetCheck>>(searcher, containerTypeMask, m_caster, position, range + extraSearchRadius);
 }
 
-void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionContainer* condList, bool isChainHeal)
+void Spell::SearchChainTargets(std::vector<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionContainer* condList, bool isChainHeal)
 {
     // max dist for jump target selection
     float jumpRadius = 0.0f;
@@ -1947,62 +1988,66 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     if (isBouncingFar)
         searchRadius *= chainTargets;
 
-    std::list<WorldObject*> tempTargets;
+    ScratchBufferPool<WorldObject*>::Lease tempTargetsBuffer = m_caster->GetMap()->GetObjectBufferPool().Acquire();
+    std::vector<WorldObject*>& tempTargets = *tempTargetsBuffer;
     SearchAreaTargets(tempTargets, searchRadius, target, m_caster, objectType, selectType, condList);
-    tempTargets.remove(target);
+    std::erase(tempTargets, target);
 
     // remove targets which are always invalid for chain spells
     // for some spells allow only chain targets in front of caster (swipe for example)
     if (!isBouncingFar)
-    {
-        for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end();)
-        {
-            std::list<WorldObject*>::iterator checkItr = itr++;
-            if (!m_caster->HasInArc(static_cast<float>(M_PI), *checkItr))
-                tempTargets.erase(checkItr);
-        }
-    }
+        std::erase_if(tempTargets, [this](WorldObject const* candidate) { return !m_caster->HasInArc(static_cast<float>(M_PI), candidate); });
+
+    // candidates ordered by distance to the current chain target, the position in tempTargets breaks ties like the old linear scan did
+    std::vector<std::pair<float, std::size_t>> byDistance;
+    byDistance.reserve(tempTargets.size());
 
     while (chainTargets)
     {
         // try to get unit for next chain jump
-        std::list<WorldObject*>::iterator foundItr = tempTargets.end();
+        std::size_t found = tempTargets.size();
         // get unit with highest hp deficit in dist
         if (isChainHeal)
         {
             uint32 maxHPDeficit = 0;
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            for (std::size_t i = 0; i < tempTargets.size(); ++i)
             {
-                if (Unit* unit = (*itr)->ToUnit())
+                if (Unit* unit = tempTargets[i]->ToUnit())
                 {
                     uint32 deficit = unit->GetMaxHealth() - unit->GetHealth();
                     if (deficit > maxHPDeficit && target->IsWithinDist(unit, jumpRadius) && target->IsWithinLOSInMap(unit, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2))
                     {
-                        foundItr = itr;
+                        found = i;
                         maxHPDeficit = deficit;
                     }
                 }
             }
         }
-        // get closest object
+        // get closest object, line of sight is only checked until the first visible candidate
         else
         {
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            byDistance.clear();
+            for (std::size_t i = 0; i < tempTargets.size(); ++i)
+                byDistance.emplace_back(target->GetExactDistSq(tempTargets[i]), i);
+
+            auto fartherFirst = [](std::pair<float, std::size_t> const& left, std::pair<float, std::size_t> const& right) { return left > right; };
+            std::make_heap(byDistance.begin(), byDistance.end(), fartherFirst);
+            for (auto heapEnd = byDistance.end(); heapEnd != byDistance.begin(); --heapEnd)
             {
-                if (foundItr == tempTargets.end())
+                std::pop_heap(byDistance.begin(), heapEnd, fartherFirst);
+                WorldObject* candidate = tempTargets[(heapEnd - 1)->second];
+                if ((!isBouncingFar || target->IsWithinDist(candidate, jumpRadius)) && target->IsWithinLOSInMap(candidate, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2))
                 {
-                    if ((!isBouncingFar || target->IsWithinDist(*itr, jumpRadius)) && target->IsWithinLOSInMap(*itr, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2))
-                        foundItr = itr;
+                    found = (heapEnd - 1)->second;
+                    break;
                 }
-                else if (target->GetDistanceOrder(*itr, *foundItr) && target->IsWithinLOSInMap(*itr, LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2))
-                    foundItr = itr;
             }
         }
         // not found any valid target - chain ends
-        if (foundItr == tempTargets.end())
+        if (found == tempTargets.size())
             break;
-        target = *foundItr;
-        tempTargets.erase(foundItr);
+        target = tempTargets[found];
+        tempTargets.erase(tempTargets.begin() + found);
         targets.push_back(target);
         --chainTargets;
     }
@@ -2116,10 +2161,10 @@ class ProcReflectDelayed : public BasicEvent
         ObjectGuid _casterGuid;
 };
 
-void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*= true*/, bool implicit /*= true*/, Position const* losPosition /*= nullptr*/)
+void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*= true*/, bool implicit /*= true*/, Position const* losPosition /*= nullptr*/, Optional<bool> inLineOfSight /*= {}*/)
 {
     for (SpellEffectInfo const& spellEffectInfo : m_spellInfo->GetEffects())
-        if (!spellEffectInfo.IsEffect() || !CheckEffectTarget(target, spellEffectInfo, losPosition))
+        if (!spellEffectInfo.IsEffect() || !CheckEffectTarget(target, spellEffectInfo, losPosition, inLineOfSight))
             effectMask &= ~(1 << spellEffectInfo.EffectIndex);
 
     // no effects left
@@ -7384,7 +7429,7 @@ CurrentSpellTypes Spell::GetCurrentContainer() const
     return CURRENT_GENERIC_SPELL;
 }
 
-bool Spell::CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEffectInfo, Position const* losPosition) const
+bool Spell::CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEffectInfo, Position const* losPosition, Optional<bool> inLineOfSight /*= {}*/) const
 {
     switch (spellEffectInfo.ApplyAuraName)
     {
@@ -7406,17 +7451,7 @@ bool Spell::CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEf
             break;
     }
 
-    // check for ignore LOS on the effect itself
-    if (m_spellInfo->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_spellInfo->Id, nullptr, SPELL_DISABLE_LOS))
-        return true;
-
-    // check if gameobject ignores LOS
-    if (GameObject const* gobCaster = m_caster->ToGameObject())
-        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
-            return true;
-
-    // if spell is triggered, need to check for LOS disable on the aura triggering it and inherit that behaviour
-    if (IsTriggered() && m_triggeredByAuraSpell && (m_triggeredByAuraSpell->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_triggeredByAuraSpell->Id, nullptr, SPELL_DISABLE_LOS)))
+    if (IsLineOfSightCheckIgnored())
         return true;
 
     /// @todo shit below shouldn't be here, but it's temporary
@@ -7471,7 +7506,13 @@ bool Spell::CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEf
         default:                                            // normal case
         {
             if (losPosition)
+            {
+                // already tested by the caller for all targets of an area at once
+                if (inLineOfSight)
+                    return *inLineOfSight;
+
                 return target->IsWithinLOS(losPosition->GetPositionX(), losPosition->GetPositionY(), losPosition->GetPositionZ(), LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2);
+            }
             else
             {
                 // Get GO cast coordinates if original caster -> GO
@@ -7490,6 +7531,24 @@ bool Spell::CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEf
     return true;
 }
 
+bool Spell::IsLineOfSightCheckIgnored() const
+{
+    // check for ignore LOS on the effect itself
+    if (m_spellInfo->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_spellInfo->Id, nullptr, SPELL_DISABLE_LOS))
+        return true;
+
+    // check if gameobject ignores LOS
+    if (GameObject const* gobCaster = m_caster->ToGameObject())
+        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+            return true;
+
+    // if spell is triggered, need to check for LOS disable on the aura triggering it and inherit that behaviour
+    if (IsTriggered() && m_triggeredByAuraSpell && (m_triggeredByAuraSpell->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_triggeredByAuraSpell->Id, nullptr, SPELL_DISABLE_LOS)))
+        return true;
+
+    return false;
+}
+
 bool Spell::IsTriggered() const
 {
     return (_triggeredCastFlags & TRIGGERED_FULL_MASK) != 0;
@@ -8097,18 +8156,30 @@ void Spell::CallScriptAfterHitHandlers()
     }
 }
 
-void Spell::CallScriptObjectAreaTargetSelectHandlers(std::list<WorldObject*>& targets, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType)
+void Spell::CallScriptObjectAreaTargetSelectHandlers(std::vector<WorldObject*>& targets, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType)
 {
+    // script hooks work on lists, only build one when a hook is going to be called
+    Optional<std::list<WorldObject*>> scriptTargets;
     for (auto scritr = m_loadedScripts.begin(); scritr != m_loadedScripts.end(); ++scritr)
     {
         (*scritr)->_PrepareScriptCall(SPELL_SCRIPT_HOOK_OBJECT_AREA_TARGET_SELECT);
         auto hookItrEnd = (*scritr)->OnObjectAreaTargetSelect.end(), hookItr = (*scritr)->OnObjectAreaTargetSelect.begin();
         for (; hookItr != hookItrEnd; ++hookItr)
+        {
             if (hookItr->IsEffectAffected(m_spellInfo, effIndex) && targetType.GetTarget() == hookItr->GetTarget())
-                hookItr->Call(*scritr, targets);
+            {
+                if (!scriptTargets)
+                    scriptTargets.emplace(targets.begin(), targets.end());
+
+                hookItr->Call(*scritr, *scriptTargets);
+            }
+        }
 
         (*scritr)->_FinishScriptCall();
     }
+
+    if (scriptTargets)
+        targets.assign(scriptTargets->begin(), scriptTargets->end());
 }
 
 void Spell::CallScriptObjectTargetSelectHandlers(WorldObject*& target, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType)
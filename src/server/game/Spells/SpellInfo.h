@@ -32,7 +32,7 @@ class SpellMgr;
 class SpellInfo;
 class Unit;
 class WorldObject;
-struct Condition;
+class ConditionContainer;
 struct SpellChainNode;
 struct SpellModifier;
 enum WeaponAttackType : uint8;
@@ -227,7 +227,7 @@ public:
     uint32    ItemType;
     uint32    TriggerSpell;
     flag96    SpellClassMask;
-    std::vector<Condition*>* ImplicitTargetConditions;
+    ConditionContainer* ImplicitTargetConditions;
 
     SpellEffectInfo();
     explicit SpellEffectInfo(SpellEntry const* spellEntry, SpellInfo const* spellInfo, uint8 effIndex);
@@ -39,6 +39,7 @@
 #include "CreatureAIRegistry.h"
 #include "CreatureGroups.h"
 #include "CreatureTextMgr.h"
+#include "CreatureUpdateProfiler.h"
 #include "DatabaseEnv.h"
 #include "DisableMgr.h"
 #include "GameEventMgr.h"
@@ -62,7 +63,9 @@
 #include "MMapFactory.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "OpcodeProfiler.h"
 #include "OutdoorPvPMgr.h"
+#include "PacketLog.h"
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
@@ -88,6 +91,7 @@
 #include "WeatherMgr.h"
 #include "WhoListStorage.h"
 #include "WorldSession.h"
+#include "WorldSessionUpdater.h"
 
 #include <boost/asio/ip/address.hpp>
 
@@ -119,6 +123,7 @@ World::World()
     m_maxQueuedSessionCount = 0;
     m_PlayerCount = 0;
     m_MaxPlayerCount = 0;
+    m_sessionUpdater = std::make_unique<WorldSessionUpdater>();
     m_NextDailyQuestReset = 0;
     m_NextWeeklyQuestReset = 0;
     m_NextMonthlyQuestReset = 0;
@@ -484,9 +489,14 @@ void World::LoadConfigSettings(bool reload)
             return;
         }
         sLog->LoadFromConfig();
+        if (sPacketLog->CanLogPacket())
+            sPacketLog->LoadFilters();
         sMetric->LoadFromConfigs();
     }
 
+    sOpcodeProfiler->SetEnabled(sConfigMgr->GetBoolDefault("OpcodeProfiler.Enable", false));
+    sCreatureUpdateProfiler->SetSampleRate(sConfigMgr->GetIntDefault("CreatureUpdateProfiler.SampleRate", 0));
+
     ///- Read the player limit and the Message of the day from the config file
     SetPlayerAmountLimit(sConfigMgr->GetIntDefault("PlayerLimit", 100));
     Motd::SetMotd(sConfigMgr->GetStringDefault("Motd", "Welcome to a Trinity Core Server."));
@@ -699,6 +709,7 @@ void World::LoadConfigSettings(bool reload)
     }
     m_int_configs[CONFIG_INTERVAL_SAVE] = sConfigMgr->GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = sConfigMgr->GetIntDefault("DisconnectToleranceInterval", 0);
+    m_int_configs[CONFIG_LOGIN_QUERY_PARALLELISM] = std::max(sConfigMgr->GetIntDefault("PlayerLogin.QueryParallelism", 4), 1);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = sConfigMgr->GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
 
     m_int_configs[CONFIG_MIN_LEVEL_STAT_SAVE] = sConfigMgr->GetIntDefault("PlayerSave.Stats.MinLevel", 0);
@@ -1458,6 +1469,7 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_SHOW_MUTE_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowMuteInWorld", false);
     m_bool_configs[CONFIG_SHOW_BAN_IN_WORLD] = sConfigMgr->GetBoolDefault("ShowBanInWorld", false);
     m_int_configs[CONFIG_NUMTHREADS] = sConfigMgr->GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_SESSION_UPDATE_THREADS] = sConfigMgr->GetIntDefault("SessionUpdate.Threads", 0);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetIntDefault("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1564,6 +1576,9 @@ void World::LoadConfigSettings(bool reload)
     // Whether to use LoS from game objects
     m_bool_configs[CONFIG_CHECK_GOBJECT_LOS] = sConfigMgr->GetBoolDefault("CheckGameObjectLoS", true);
 
+    // Number of cached terrain and line of sight query results per query type and map
+    m_int_configs[CONFIG_MAP_QUERY_CACHE_SIZE] = sConfigMgr->GetIntDefault("MapQueryCacheSize", 1024);
+
     // Anti movement cheat measure. Time each client have to acknowledge a movement change until they are kicked
     m_int_configs[CONFIG_PENDING_MOVE_CHANGES_TIMEOUT] = sConfigMgr->GetIntDefault("AntiCheat.PendingMoveChangesTimeoutTime", 0);
 
@@ -2177,6 +2192,12 @@ void World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Starting Map System");
     sMapMgr->Initialize();
 
+    if (uint32 sessionUpdateThreads = getIntConfig(CONFIG_SESSION_UPDATE_THREADS))
+    {
+        TC_LOG_INFO("server.loading", "Starting {} session update threads", sessionUpdateThreads);
+        m_sessionUpdater->Activate(sessionUpdateThreads);
+    }
+
     TC_LOG_INFO("server.loading", "Starting Game Event system...");
     uint32 nextGameEvent = sGameEventMgr->StartSystem();
     m_timers[WUPDATE_EVENTS].SetInterval(nextGameEvent);    //depend on next event
@@ -2444,6 +2465,9 @@ void World::Update(uint32 diff)
         m_timers[WUPDATE_CHECK_FILECHANGES].Reset();
     }
 
+    /// <li> Free character cache entries replaced during the last tick, no map or session thread is running here
+    sCharacterCache->ReleaseRetiredEntries();
+
     {
         /// <li> Handle session updates when the timer has passed
         TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update sessions"));
@@ -3097,6 +3121,29 @@ void World::UpdateSessions(uint32 diff)
             AddSession_(sess);
     }
 
+    ///- Sessions that are not on a map yet (character selection, loading screen, queue) are independent
+    ///  from each other, let the workers handle their session local packets before the serial pass
+    if (m_sessionUpdater->Activated())
+    {
+        TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+            TC_METRIC_TAG("type", "Update detached sessions"),
+            TC_METRIC_TAG("parent_type", "Update sessions"));
+
+        m_detachedSessions.clear();
+        for (SessionMap::value_type const& pair : m_sessions)
+            if (!pair.second->GetPlayer() && !pair.second->PlayerLoading() && !pair.second->PlayerLogout())
+                m_detachedSessions.push_back(pair.second);
+
+        m_sessionUpdater->ScheduleUpdate(m_detachedSessions, diff);
+        m_sessionUpdater->Wait();
+
+        TC_METRIC_VALUE("detached_sessions", uint64(m_detachedSessions.size()));
+    }
+
+    TC_METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+        TC_METRIC_TAG("type", "Update world sessions"),
+        TC_METRIC_TAG("parent_type", "Update sessions"));
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(), next; itr != m_sessions.end(); itr = next)
     {
@@ -3122,6 +3169,13 @@ void World::UpdateSessions(uint32 diff)
     }
 }
 
+/// Stop the session update workers, must be called after the last UpdateSessions() call
+void World::StopSessionUpdater()
+{
+    if (m_sessionUpdater->Activated())
+        m_sessionUpdater->Deactivate();
+}
+
 // This handles the issued and queued CLI commands
 void World::ProcessCliCommands()
 {
@@ -33,11 +33,14 @@
 #include <atomic>
 #include <list>
 #include <map>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 class Player;
 class WorldPacket;
 class WorldSession;
+class WorldSessionUpdater;
 class WorldSocket;
 struct Realm;
 
@@ -214,6 +217,7 @@ enum WorldIntConfigs : uint32
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
+    CONFIG_LOGIN_QUERY_PARALLELISM,
     CONFIG_PORT_WORLD,
     CONFIG_SOCKET_TIMEOUTTIME,
     CONFIG_SESSION_ADD_DELAY,
@@ -332,6 +336,7 @@ enum WorldIntConfigs : uint32
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_SESSION_UPDATE_THREADS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
@@ -401,6 +406,7 @@ enum WorldIntConfigs : uint32
     CONFIG_RESPAWN_GUIDWARNING_FREQUENCY,
     CONFIG_SOCKET_TIMEOUTTIME_ACTIVE,
     CONFIG_PENDING_MOVE_CHANGES_TIMEOUT,
+    CONFIG_MAP_QUERY_CACHE_SIZE,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -671,6 +677,7 @@ class TC_GAME_API World
         void Update(uint32 diff);
 
         void UpdateSessions(uint32 diff);
+        void StopSessionUpdater();
         /// Set a server rate (see #Rates)
         void setRate(Rates rate, float value) { rate_values[rate]=value; }
         /// Get a server rate (see #Rates)
@@ -807,6 +814,8 @@ class TC_GAME_API World
         time_t mail_timer_expires;
 
         SessionMap m_sessions;
+        std::vector<WorldSession*> m_detachedSessions;
+        std::unique_ptr<WorldSessionUpdater> m_sessionUpdater;
         typedef std::unordered_map<uint32, time_t> DisconnectMap;
         DisconnectMap m_disconnects;
         uint32 m_maxActiveSessionCount;
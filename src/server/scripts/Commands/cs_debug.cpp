@@ -29,6 +29,8 @@ EndScriptData */
 #include "CellImpl.h"
 #include "Channel.h"
 #include "Chat.h"
+#include "ConditionMgr.h"
+#include "CreatureUpdateProfiler.h"
 #include "GameTime.h"
 #include "GossipDef.h"
 #include "GridNotifiersImpl.h"
@@ -39,6 +41,8 @@ EndScriptData */
 #include "MapManager.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
+#include "OpcodeProfiler.h"
 #include "PoolMgr.h"
 #include "QuestPools.h"
 #include "RBAC.h"
@@ -120,6 +124,11 @@ public:
             { "guidlimits",         HandleDebugGuidLimitsCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "objectcount",        HandleDebugObjectCountCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "questreset",         HandleDebugQuestResetCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "conditions",         HandleDebugConditionsCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "allocators",         HandleDebugAllocatorsCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "playersaves",        HandleDebugPlayerSavesCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "opcodes",            HandleDebugOpcodesCommand,             rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "creatureupdates",    HandleDebugCreatureUpdatesCommand,     rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "warden force",       HandleDebugWardenForce,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes }
         };
         static ChatCommandTable commandTable =
@@ -1484,6 +1493,168 @@ public:
         return true;
     }
 
+    static bool HandleDebugConditionsCommand(ChatHandler* handler)
+    {
+        handler->SendSysMessage("Condition lists evaluated since startup, by source type:");
+        for (uint32 i = 0; i < CONDITION_SOURCE_TYPE_MAX; ++i)
+        {
+            ConditionMgr::EvaluationCounters counters = sConditionMgr->GetEvaluationCounters(ConditionSourceType(i));
+            if (!counters.Lists)
+                continue;
+
+            handler->PSendSysMessage("%u (%s): " UI64FMTD " lists, " UI64FMTD " conditions checked, %.2f per list", i, ConditionMgr::StaticSourceTypeData[i],
+                counters.Lists, counters.Conditions, double(counters.Conditions) / counters.Lists);
+        }
+        return true;
+    }
+
+    static bool HandleDebugAllocatorsCommand(ChatHandler* handler)
+    {
+#ifdef TRINITY_OBJECT_POOL_PASSTHROUGH
+        handler->SendSysMessage("Object pools are disabled in sanitizer builds, objects are allocated with operator new.");
+#else
+        handler->SendSysMessage("Object pools:");
+        ObjectPoolBase::VisitPools([handler](ObjectPoolStatistics const& statistics)
+        {
+            handler->PSendSysMessage("%s: " UI64FMTD " live, " UI64FMTD " allocations, block size " SZFMTD ", " UI64FMTD " chunks, " SZFMTD " bytes reserved",
+                statistics.Name, statistics.Allocations - statistics.Deallocations, statistics.Allocations, statistics.BlockSize, statistics.Chunks, statistics.ReservedBytes);
+        });
+#endif
+        return true;
+    }
+
+    static bool HandleDebugPlayerSavesCommand(ChatHandler* handler)
+    {
+        static char const* const sectionNames[MAX_PLAYER_SAVE_SECTIONS] =
+        {
+            "character", "inventory", "quests", "spells", "actions", "auras", "skills", "achievements", "reputation", "stats", "other"
+        };
+
+        PlayerSaveStatistics statistics = Player::GetSaveStatistics();
+        handler->PSendSysMessage("Player saves since startup: " UI64FMTD, statistics.Saves);
+        if (!statistics.Saves)
+            return true;
+
+        uint64 total = 0;
+        for (uint8 i = 0; i < MAX_PLAYER_SAVE_SECTIONS; ++i)
+        {
+            total += statistics.Statements[i];
+            handler->PSendSysMessage("%s: " UI64FMTD " statements, %.2f per save", sectionNames[i], statistics.Statements[i], double(statistics.Statements[i]) / statistics.Saves);
+        }
+
+        handler->PSendSysMessage("total: " UI64FMTD " statements, %.2f per save", total, double(total) / statistics.Saves);
+        return true;
+    }
+
+    static bool HandleDebugOpcodesCommand(ChatHandler* handler, Optional<Variant<uint32, EXACT_SEQUENCE("on"), EXACT_SEQUENCE("off"), EXACT_SEQUENCE("reset")>> arg)
+    {
+        uint32 count = 20;
+        if (arg)
+        {
+            switch (arg->index())
+            {
+                case 0:
+                    count = arg->get<uint32>();
+                    break;
+                case 1:
+                    sOpcodeProfiler->SetEnabled(true);
+                    handler->SendSysMessage("Opcode profiling enabled.");
+                    return true;
+                case 2:
+                    sOpcodeProfiler->SetEnabled(false);
+                    handler->SendSysMessage("Opcode profiling disabled.");
+                    return true;
+                case 3:
+                    sOpcodeProfiler->Reset();
+                    handler->SendSysMessage("Opcode statistics reset.");
+                    return true;
+            }
+        }
+
+        std::vector<OpcodeProfileEntry> statistics = sOpcodeProfiler->GetStatistics();
+        handler->PSendSysMessage("Opcode profiling is %s, %u opcodes handled since the last reset.", sOpcodeProfiler->IsEnabled() ? "enabled" : "disabled", uint32(statistics.size()));
+        if (statistics.size() > count)
+            statistics.resize(count);
+
+        for (OpcodeProfileEntry const& entry : statistics)
+        {
+            handler->PSendSysMessage("%s: " UI64FMTD " calls, total %.3f ms, avg %.1f us, max %.1f us, avg %.1f bytes",
+                opcodeTable[static_cast<Opcodes>(entry.Opcode)]->Name, entry.Count, entry.TotalTime / 1000000.0,
+                entry.TotalTime / 1000.0 / entry.Count, entry.MaxTime / 1000.0, double(entry.Bytes) / entry.Count);
+        }
+
+        return true;
+    }
+
+    static bool HandleDebugCreatureUpdatesCommand(ChatHandler* handler, Optional<Variant<uint32, EXACT_SEQUENCE("scripts"), EXACT_SEQUENCE("reset")>> arg)
+    {
+        uint32 count = 20;
+        bool byScript = false;
+        if (arg)
+        {
+            switch (arg->index())
+            {
+                case 0:
+                    count = arg->get<uint32>();
+                    break;
+                case 1:
+                    byScript = true;
+                    break;
+                case 2:
+                    sCreatureUpdateProfiler->Reset();
+                    handler->SendSysMessage("Creature update statistics reset.");
+                    return true;
+            }
+        }
+
+        if (!sCreatureUpdateProfiler->GetSampleRate())
+            handler->SendSysMessage("Creature update profiling is disabled, set CreatureUpdateProfiler.SampleRate to enable it.");
+        else
+            handler->PSendSysMessage("Measuring one of every %u creature updates.", sCreatureUpdateProfiler->GetSampleRate());
+
+        std::vector<CreatureUpdateCost> statistics = sCreatureUpdateProfiler->GetStatistics();
+        if (byScript)
+        {
+            std::unordered_map<std::string, CreatureUpdateCost> scripts;
+            for (CreatureUpdateCost const& cost : statistics)
+                scripts[CreatureUpdateProfiler::GetScriptName(cost.Entry)].Add(cost);
+
+            std::vector<std::pair<std::string, CreatureUpdateCost>> sorted(scripts.begin(), scripts.end());
+            std::sort(sorted.begin(), sorted.end(), [](auto const& left, auto const& right)
+            {
+                return left.second.Time[CREATURE_UPDATE_SECTION_TOTAL] > right.second.Time[CREATURE_UPDATE_SECTION_TOTAL];
+            });
+
+            if (sorted.size() > count)
+                sorted.resize(count);
+
+            for (auto const& [scriptName, cost] : sorted)
+                SendCreatureUpdateCost(handler, scriptName, cost);
+            return true;
+        }
+
+        if (statistics.size() > count)
+            statistics.resize(count);
+
+        for (CreatureUpdateCost const& cost : statistics)
+        {
+            CreatureTemplate const* creatureTemplate = sObjectMgr->GetCreatureTemplate(cost.Entry);
+            SendCreatureUpdateCost(handler, Trinity::StringFormat("{} ({}, {})", cost.Entry, creatureTemplate ? creatureTemplate->Name : "unknown",
+                CreatureUpdateProfiler::GetScriptName(cost.Entry)), cost);
+        }
+
+        return true;
+    }
+
+    static void SendCreatureUpdateCost(ChatHandler* handler, std::string const& name, CreatureUpdateCost const& cost)
+    {
+        double total = cost.Time[CREATURE_UPDATE_SECTION_TOTAL];
+        auto percent = [&](CreatureUpdateSection section) { return total ? cost.Time[section] * 100.0 / total : 0.0; };
+        handler->PSendSysMessage("%s: " UI64FMTD " samples, est. %.1f ms, avg %.1f us, max %.1f us, AI %.0f%%, movement %.0f%%, SmartScript %.0f%%",
+            name.c_str(), cost.Samples, total / 1000000.0, total / 1000.0 / cost.EstimatedCalls, cost.MaxTime / 1000.0,
+            percent(CREATURE_UPDATE_SECTION_AI), percent(CREATURE_UPDATE_SECTION_MOTION), percent(CREATURE_UPDATE_SECTION_SMARTSCRIPT));
+    }
+
     static bool HandleDebugQuestResetCommand(ChatHandler* handler, std::string arg)
     {
         if (!Utf8ToUpperOnlyLatin(arg))
@@ -24,6 +24,7 @@ EndScriptData */
 
 #include "ScriptMgr.h"
 #include "AccountMgr.h"
+#include "CharacterCache.h"
 #include "Chat.h"
 #include "DatabaseEnv.h"
 #include "DBCStores.h"
@@ -55,6 +56,7 @@ public:
             { "ip",      rbac::RBAC_PERM_COMMAND_LOOKUP_PLAYER_IP,      true, &HandleLookupPlayerIpCommand,        "" },
             { "account", rbac::RBAC_PERM_COMMAND_LOOKUP_PLAYER_ACCOUNT, true, &HandleLookupPlayerAccountCommand,   "" },
             { "email",   rbac::RBAC_PERM_COMMAND_LOOKUP_PLAYER_EMAIL,   true, &HandleLookupPlayerEmailCommand,     "" },
+            { "name",    rbac::RBAC_PERM_COMMAND_LOOKUP_PLAYER,         true, &HandleLookupPlayerNameCommand,      "" },
         };
 
         static std::vector<ChatCommand> lookupCommandTable =
@@ -1493,6 +1495,44 @@ public:
         return LookupPlayerSearchCommand(result, limit, handler);
     }
 
+    static bool HandleLookupPlayerNameCommand(ChatHandler* handler, char const* args)
+    {
+        if (!*args)
+            return false;
+
+        std::string prefix = strtok((char*)args, " ");
+        char* limitStr = strtok(nullptr, " ");
+        int32 limit = limitStr ? atoi(limitStr) : -1;
+
+        uint32 maxResults = sWorld->getIntConfig(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS);
+        if (limit > 0 && (!maxResults || uint32(limit) < maxResults))
+            maxResults = limit;
+
+        // one more than shown, to tell whether the list was cut
+        std::vector<CharacterCacheEntry const*> characters = sCharacterCache->GetCharacterCacheByNamePrefix(prefix, maxResults ? maxResults + 1 : std::numeric_limits<std::size_t>::max());
+        if (characters.empty())
+        {
+            handler->PSendSysMessage(LANG_NO_PLAYERS_FOUND);
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        for (std::size_t i = 0; i < characters.size(); ++i)
+        {
+            if (maxResults && i == maxResults)
+            {
+                handler->PSendSysMessage(LANG_COMMAND_LOOKUP_MAX_RESULTS, maxResults);
+                break;
+            }
+
+            CharacterCacheEntry const* character = characters[i];
+            bool online = ObjectAccessor::FindConnectedPlayer(character->Guid) != nullptr;
+            handler->PSendSysMessage(LANG_LOOKUP_PLAYER_CHARACTER, character->Name.c_str(), character->Guid.GetCounter(), online ? handler->GetTrinityString(LANG_ONLINE) : "");
+        }
+
+        return true;
+    }
+
     static bool LookupPlayerSearchCommand(PreparedQueryResult result, int32 limit, ChatHandler* handler)
     {
         if (!result)
@@ -27,6 +27,7 @@
 #include "BigNumber.h"
 #include "CliRunnable.h"
 #include "Configuration/Config.h"
+#include "CreatureUpdateProfiler.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "DeadlineTimer.h"
@@ -38,6 +39,7 @@
 #include "Metric.h"
 #include "MySQLThreading.h"
 #include "ObjectAccessor.h"
+#include "OpcodeProfiler.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvP/OutdoorPvPMgr.h"
 #include "ProcessPriority.h"
@@ -302,6 +304,8 @@ extern int main(int argc, char** argv)
         TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        sOpcodeProfiler->LogMetrics();
+        sCreatureUpdateProfiler->LogMetrics();
     });
 
     TC_METRIC_EVENT("events", "Worldserver started", "");
@@ -374,6 +378,7 @@ extern int main(int argc, char** argv)
     {
         sWorld->KickAll();              // save and kick all players
         sWorld->UpdateSessions(1);      // real players unload required UpdateSessions call
+        sWorld->StopSessionUpdater();
 
         sWorldSocketMgr.StopNetwork();
 
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AliasTable.h"
+
+namespace
+{
+    // exact probability of every index, by walking all columns with a fine grid of coins
+    std::vector<double> Distribution(AliasTable const& table)
+    {
+        constexpr uint32 Steps = 10000;
+        std::vector<double> result(table.size(), 0.0);
+        for (std::size_t column = 0; column < table.size(); ++column)
+            for (uint32 step = 0; step < Steps; ++step)
+                result[table.Select(column, (step + 0.5) / Steps)] += 1.0 / (Steps * table.size());
+        return result;
+    }
+}
+
+TEST_CASE("AliasTable", "[AliasTable]")
+{
+    SECTION("single weight")
+    {
+        AliasTable table({ 5.0 });
+        REQUIRE(table.size() == 1);
+        REQUIRE(table.Select() == 0);
+    }
+
+    SECTION("matches weights")
+    {
+        std::vector<double> weights = { 10.0, 0.5, 25.0, 0.0, 64.5 };
+        AliasTable table(weights);
+        std::vector<double> distribution = Distribution(table);
+        for (std::size_t i = 0; i < weights.size(); ++i)
+            REQUIRE(distribution[i] == Approx(weights[i] / 100.0).margin(0.0001));
+    }
+
+    SECTION("zero weights are never selected")
+    {
+        AliasTable table({ 0.0, 1.0, 0.0, 3.0 });
+        for (uint32 i = 0; i < 1000; ++i)
+        {
+            std::size_t index = table.Select();
+            REQUIRE((index == 1 || index == 3));
+        }
+    }
+}
@@ -0,0 +1,260 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "DynamicBoundingVolumeHierarchy.h"
+#include <memory>
+#include <random>
+#include <set>
+
+namespace
+{
+    struct TestObject
+    {
+        G3D::AABox Bounds;
+    };
+}
+
+template<> struct BoundsTrait<TestObject>
+{
+    static void getBounds(TestObject const& obj, G3D::AABox& out) { out = obj.Bounds; }
+};
+
+namespace
+{
+    using TestTree = DynamicBVH<TestObject>;
+
+    struct CollectingCallback
+    {
+        std::set<TestObject const*> Hits;
+
+        bool operator()(G3D::Ray const& /*ray*/, TestObject const& obj, float& /*maxDist*/)
+        {
+            Hits.insert(&obj);
+            return false;
+        }
+
+        void operator()(G3D::Vector3 const& /*point*/, TestObject const& obj)
+        {
+            Hits.insert(&obj);
+        }
+    };
+
+    struct FirstHitCallback
+    {
+        uint32 Calls = 0;
+
+        bool operator()(G3D::Ray const& /*ray*/, TestObject const& /*obj*/, float& /*maxDist*/)
+        {
+            ++Calls;
+            return true;
+        }
+    };
+
+    G3D::AABox RandomBox(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> size(1.0f, 20.0f);
+        G3D::Vector3 low(position(rng), position(rng), position(rng) * 0.1f);
+        return G3D::AABox(low, low + G3D::Vector3(size(rng), size(rng), size(rng)));
+    }
+
+    std::set<TestObject const*> BruteForceRay(std::vector<std::unique_ptr<TestObject>> const& objects, std::set<TestObject const*> const& inTree, G3D::Ray const& ray, float maxDist)
+    {
+        std::set<TestObject const*> hits;
+        for (std::unique_ptr<TestObject> const& obj : objects)
+        {
+            if (!inTree.count(obj.get()))
+                continue;
+
+            float distance = ray.intersectionTime(obj->Bounds);
+            if (obj->Bounds.contains(ray.origin()) || distance <= maxDist)
+                hits.insert(obj.get());
+        }
+        return hits;
+    }
+
+    void CheckQueries(TestTree& tree, std::vector<std::unique_ptr<TestObject>> const& objects, std::set<TestObject const*> const& inTree, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position(-520.0f, 520.0f);
+        for (uint32 i = 0; i < 200; ++i)
+        {
+            G3D::Vector3 start(position(rng), position(rng), position(rng) * 0.1f);
+            G3D::Vector3 end(position(rng), position(rng), position(rng) * 0.1f);
+            float maxDist = (end - start).magnitude();
+            G3D::Ray ray(start, (end - start) / maxDist);
+
+            CollectingCallback callback;
+            float distance = maxDist;
+            tree.intersectRay(ray, callback, distance);
+            REQUIRE(callback.Hits == BruteForceRay(objects, inTree, ray, maxDist));
+
+            CollectingCallback pointCallback;
+            tree.intersectPoint(start, pointCallback);
+            std::set<TestObject const*> expected;
+            for (TestObject const* obj : inTree)
+                if (obj->Bounds.contains(start))
+                    expected.insert(obj);
+            REQUIRE(pointCallback.Hits == expected);
+        }
+    }
+}
+
+TEST_CASE("DynamicBVH", "[DynamicBVH]")
+{
+    std::mt19937 rng(1234);
+    std::vector<std::unique_ptr<TestObject>> objects;
+    std::set<TestObject const*> inTree;
+    TestTree tree;
+
+    for (uint32 i = 0; i < 300; ++i)
+    {
+        objects.push_back(std::make_unique<TestObject>(TestObject{ RandomBox(rng) }));
+        tree.insert(*objects.back());
+        inTree.insert(objects.back().get());
+    }
+
+    REQUIRE(tree.size() == 300);
+    REQUIRE(tree.needsRebuild());
+
+    SECTION("pending objects")
+    {
+        CheckQueries(tree, objects, inTree, rng);
+    }
+
+    tree.balance();
+    REQUIRE_FALSE(tree.needsRebuild());
+
+    SECTION("bulk loaded")
+    {
+        CheckQueries(tree, objects, inTree, rng);
+    }
+
+    SECTION("moved objects are refit")
+    {
+        for (uint32 i = 0; i < 300; i += 3)
+        {
+            G3D::AABox previous = objects[i]->Bounds;
+            objects[i]->Bounds = RandomBox(rng);
+            REQUIRE(tree.update(*objects[i]) == previous);
+        }
+
+        CheckQueries(tree, objects, inTree, rng);
+        REQUIRE(tree.needsRebuild());
+        tree.balance();
+        CheckQueries(tree, objects, inTree, rng);
+    }
+
+    SECTION("insert and remove")
+    {
+        for (uint32 i = 0; i < 300; i += 2)
+        {
+            tree.remove(*objects[i]);
+            inTree.erase(objects[i].get());
+        }
+
+        for (uint32 i = 0; i < 10; ++i)
+        {
+            objects.push_back(std::make_unique<TestObject>(TestObject{ RandomBox(rng) }));
+            tree.insert(*objects.back());
+            inTree.insert(objects.back().get());
+        }
+
+        // removing pending objects keeps the others reachable
+        tree.remove(*objects[302]);
+        inTree.erase(objects[302].get());
+
+        REQUIRE(tree.size() == inTree.size());
+        REQUIRE_FALSE(tree.contains(*objects[0]));
+        REQUIRE(tree.contains(*objects[1]));
+        CheckQueries(tree, objects, inTree, rng);
+
+        tree.balance();
+        CheckQueries(tree, objects, inTree, rng);
+    }
+
+    SECTION("stop at first hit")
+    {
+        G3D::Ray ray(objects[0]->Bounds.center() - G3D::Vector3(100.0f, 0.0f, 0.0f), G3D::Vector3(1.0f, 0.0f, 0.0f));
+        float maxDist = 200.0f;
+        FirstHitCallback callback;
+        tree.intersectRay(ray, callback, maxDist);
+        REQUIRE(callback.Calls == 1);
+    }
+}
+
+TEST_CASE("DynamicBVH moving objects", "[.][benchmark][DynamicBVH]")
+{
+    std::mt19937 rng(1234);
+    std::vector<std::unique_ptr<TestObject>> objects;
+    TestTree tree;
+    for (uint32 i = 0; i < 2000; ++i)
+    {
+        objects.push_back(std::make_unique<TestObject>(TestObject{ RandomBox(rng) }));
+        tree.insert(*objects.back());
+    }
+    tree.balance();
+
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::vector<G3D::Ray> rays;
+    for (uint32 i = 0; i < 100; ++i)
+    {
+        G3D::Vector3 start(position(rng), position(rng), 0.0f);
+        G3D::Vector3 end = start + G3D::Vector3(position(rng), position(rng), 0.0f) * 0.1f;
+        rays.emplace_back(start, (end - start).direction());
+    }
+
+    // 50 transports move a little every tick, then a batch of line of sight checks runs
+    auto tick = [&](bool refit)
+    {
+        for (uint32 i = 0; i < 50; ++i)
+        {
+            TestObject& obj = *objects[i];
+            if (!refit)
+                tree.remove(obj);
+            obj.Bounds = obj.Bounds + G3D::Vector3(0.5f, 0.0f, 0.0f);
+            if (refit)
+                tree.update(obj);
+            else
+                tree.insert(obj);
+        }
+
+        if (!refit)
+            tree.balance();
+
+        uint32 hits = 0;
+        for (G3D::Ray const& ray : rays)
+        {
+            CollectingCallback callback;
+            float maxDist = 50.0f;
+            tree.intersectRay(ray, callback, maxDist);
+            hits += uint32(callback.Hits.size());
+        }
+        return hits;
+    };
+
+    BENCHMARK("remove, insert and rebuild")
+    {
+        return tick(false);
+    };
+
+    BENCHMARK("refit")
+    {
+        return tick(true);
+    };
+}
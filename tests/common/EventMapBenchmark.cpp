@@ -0,0 +1,115 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "EventMap.h"
+#include "EventProcessor.h"
+#include <map>
+
+// Hidden from the default run, execute with: tests "[benchmark]"
+
+namespace
+{
+    // typical creature AI: a handful of recurring abilities
+    constexpr uint32 EventsPerMap = 8;
+    constexpr uint32 MapCount = 1000;
+    constexpr uint32 Ticks = 100;
+    constexpr uint32 TickDiff = 50;
+
+    // storage used by EventMap before it was flattened, kept as baseline
+    struct MultimapEventMap
+    {
+        void ScheduleEvent(uint16 eventId, Milliseconds time) { Events.emplace(Time + time, eventId); }
+        void Update(uint32 diff) { Time += Milliseconds(diff); }
+        uint16 ExecuteEvent()
+        {
+            if (Events.empty() || Events.begin()->first > Time)
+                return 0;
+
+            uint16 eventId = Events.begin()->second;
+            Events.erase(Events.begin());
+            return eventId;
+        }
+
+        TimePoint Time = TimePoint::min();
+        std::multimap<TimePoint, uint16> Events;
+    };
+
+    template<class Map>
+    uint64 RunCreatureAIs(std::vector<Map>& maps)
+    {
+        uint64 executed = 0;
+        for (Map& map : maps)
+            for (uint16 i = 1; i <= EventsPerMap; ++i)
+                map.ScheduleEvent(i, Milliseconds(i * 700));
+
+        for (uint32 tick = 0; tick < Ticks; ++tick)
+        {
+            for (Map& map : maps)
+            {
+                map.Update(TickDiff);
+                while (uint16 eventId = map.ExecuteEvent())
+                {
+                    map.ScheduleEvent(eventId, Milliseconds(eventId * 700));
+                    ++executed;
+                }
+            }
+        }
+        return executed;
+    }
+
+    struct CountingEvent : BasicEvent
+    {
+        explicit CountingEvent(uint64& counter) : Counter(counter) { }
+        bool Execute(uint64, uint32) override { ++Counter; return true; }
+        uint64& Counter;
+    };
+}
+
+TEST_CASE("EventMap creature AI workload", "[.][benchmark][EventMap]")
+{
+    BENCHMARK("std::multimap baseline")
+    {
+        std::vector<MultimapEventMap> maps(MapCount);
+        return RunCreatureAIs(maps);
+    };
+
+    BENCHMARK("EventMap")
+    {
+        std::vector<EventMap> maps(MapCount);
+        return RunCreatureAIs(maps);
+    };
+}
+
+TEST_CASE("EventProcessor delayed hits", "[.][benchmark][EventProcessor]")
+{
+    BENCHMARK("EventProcessor")
+    {
+        uint64 executed = 0;
+        EventProcessor events;
+        for (uint32 tick = 0; tick < Ticks; ++tick)
+        {
+            // spell projectiles and aura ticks of a busy unit
+            for (uint32 i = 0; i < 50; ++i)
+                events.AddEventAtOffset(new CountingEvent(executed), Milliseconds(100 + (i * 37) % 1500));
+            events.Update(TickDiff);
+        }
+        events.KillAllEvents(true);
+        return executed;
+    };
+}
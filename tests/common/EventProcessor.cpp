@@ -0,0 +1,81 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "EventProcessor.h"
+#include <vector>
+
+namespace
+{
+    struct RecordingEvent : BasicEvent
+    {
+        RecordingEvent(std::vector<int>& log, int id, bool deletable = true) : Log(log), Id(id), Deletable(deletable) { }
+
+        bool Execute(uint64, uint32) override { Log.push_back(Id); return true; }
+        void Abort(uint64) override { Log.push_back(-Id); }
+        bool IsDeletable() const override { return Deletable; }
+
+        std::vector<int>& Log;
+        int Id;
+        bool Deletable;
+    };
+}
+
+TEST_CASE("EventProcessor execution order", "[EventProcessor]")
+{
+    std::vector<int> log;
+    EventProcessor events;
+
+    SECTION("Events run by time, equal times in insertion order")
+    {
+        events.AddEventAtOffset(new RecordingEvent(log, 3), 200ms);
+        events.AddEventAtOffset(new RecordingEvent(log, 1), 100ms);
+        events.AddEventAtOffset(new RecordingEvent(log, 2), 100ms);
+
+        events.Update(50);
+        REQUIRE(log.empty());
+
+        events.Update(200);
+        REQUIRE(log == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("ModifyEventTime moves an event")
+    {
+        RecordingEvent* late = new RecordingEvent(log, 1);
+        events.AddEventAtOffset(late, 500ms);
+        events.AddEventAtOffset(new RecordingEvent(log, 2), 100ms);
+        events.ModifyEventTime(late, events.CalculateTime(100ms));
+
+        events.Update(100);
+        REQUIRE(log == std::vector<int>{ 2, 1 });
+    }
+
+    SECTION("KillAllEvents keeps non deletable events")
+    {
+        events.AddEventAtOffset(new RecordingEvent(log, 1), 100ms);
+        RecordingEvent* kept = new RecordingEvent(log, 2, false);
+        events.AddEventAtOffset(kept, 100ms);
+
+        events.KillAllEvents(false);
+        REQUIRE(log == std::vector<int>{ -1, -2 });
+
+        kept->Deletable = true;
+        events.Update(200);
+        REQUIRE(log == std::vector<int>{ -1, -2 });
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "IntrusiveHeap.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace
+{
+    struct Node
+    {
+        explicit Node(int32 key) : Key(key) { }
+
+        int32 Key;
+        std::size_t HeapIndex = 0;
+    };
+
+    // smallest key on top
+    struct CompareNode
+    {
+        bool operator()(Node const* a, Node const* b) const { return a->Key > b->Key; }
+    };
+
+    using NodeHeap = IntrusiveHeap<Node, CompareNode, &Node::HeapIndex>;
+
+    std::vector<int32> Drain(NodeHeap& heap)
+    {
+        std::vector<int32> keys;
+        while (!heap.empty())
+        {
+            keys.push_back(heap.top()->Key);
+            heap.pop();
+        }
+        return keys;
+    }
+}
+
+TEST_CASE("IntrusiveHeap", "[IntrusiveHeap]")
+{
+    std::mt19937 random(42);
+    std::vector<std::unique_ptr<Node>> nodes;
+    NodeHeap heap;
+    for (int32 i = 0; i < 200; ++i)
+    {
+        nodes.push_back(std::make_unique<Node>(int32(random() % 1000)));
+        heap.push(nodes.back().get());
+    }
+
+    REQUIRE(heap.size() == 200);
+
+    SECTION("pops in order")
+    {
+        std::vector<int32> keys = Drain(heap);
+        REQUIRE(keys.size() == 200);
+        REQUIRE(std::is_sorted(keys.begin(), keys.end()));
+    }
+
+    SECTION("erase")
+    {
+        for (std::size_t i = 0; i < nodes.size(); i += 3)
+            heap.erase(nodes[i].get());
+
+        std::vector<int32> expected;
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            if (i % 3)
+                expected.push_back(nodes[i]->Key);
+        std::sort(expected.begin(), expected.end());
+
+        REQUIRE(Drain(heap) == expected);
+    }
+
+    SECTION("update in both directions")
+    {
+        std::vector<int32> expected;
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            nodes[i]->Key += (i % 2) ? 500 : -500;
+            heap.update(nodes[i].get());
+            expected.push_back(nodes[i]->Key);
+        }
+        std::sort(expected.begin(), expected.end());
+
+        REQUIRE(Drain(heap) == expected);
+    }
+
+    SECTION("iteration visits every node")
+    {
+        std::size_t count = 0;
+        for (Node const* node : heap)
+        {
+            REQUIRE(node == *(heap.begin() + node->HeapIndex));
+            ++count;
+        }
+        REQUIRE(count == nodes.size());
+    }
+}
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ObjectPool.h"
+#include <cstring>
+#include <memory>
+#include <set>
+#include <thread>
+
+namespace
+{
+    struct PooledObject
+    {
+        virtual ~PooledObject() = default;
+
+        TC_DECLARE_POOLED_ALLOCATION();
+
+        uint64 Value = 0;
+    };
+
+    struct LargerPooledObject : PooledObject
+    {
+        char Padding[64] = { };
+    };
+
+    ObjectPoolStatistics GetPoolStatistics(char const* name)
+    {
+        ObjectPoolStatistics result = { };
+        ObjectPoolBase::VisitPools([&](ObjectPoolStatistics const& statistics)
+        {
+            if (!std::strcmp(statistics.Name, name))
+                result = statistics;
+        });
+        return result;
+    }
+}
+
+TC_DEFINE_POOLED_ALLOCATION(PooledObject)
+
+TEST_CASE("ObjectPool", "[ObjectPool]")
+{
+    SECTION("blocks are aligned and reused")
+    {
+        std::set<PooledObject*> allocated;
+        std::vector<std::unique_ptr<PooledObject>> objects;
+        for (uint32 i = 0; i < 1000; ++i)
+        {
+            objects.push_back(std::make_unique<PooledObject>());
+            objects.back()->Value = i;
+            REQUIRE(reinterpret_cast<uintptr_t>(objects.back().get()) % alignof(PooledObject) == 0);
+            allocated.insert(objects.back().get());
+        }
+
+        REQUIRE(allocated.size() == 1000);
+        for (uint32 i = 0; i < 1000; ++i)
+            REQUIRE(objects[i]->Value == i);
+
+        objects.clear();
+
+#ifndef TRINITY_OBJECT_POOL_PASSTHROUGH
+        std::unique_ptr<PooledObject> reused = std::make_unique<PooledObject>();
+        REQUIRE(allocated.count(reused.get()));
+#endif
+    }
+
+#ifndef TRINITY_OBJECT_POOL_PASSTHROUGH
+    SECTION("statistics")
+    {
+        ObjectPoolStatistics before = GetPoolStatistics("PooledObject");
+        {
+            std::unique_ptr<PooledObject> first = std::make_unique<PooledObject>();
+            std::unique_ptr<PooledObject> second = std::make_unique<PooledObject>();
+
+            ObjectPoolStatistics during = GetPoolStatistics("PooledObject");
+            REQUIRE(during.Allocations - before.Allocations == 2);
+            REQUIRE(during.Allocations - during.Deallocations == before.Allocations - before.Deallocations + 2);
+            REQUIRE(during.BlockSize >= sizeof(PooledObject));
+            REQUIRE(during.ReservedBytes >= during.BlockSize * during.Chunks);
+        }
+
+        ObjectPoolStatistics after = GetPoolStatistics("PooledObject");
+        REQUIRE(after.Allocations - after.Deallocations == before.Allocations - before.Deallocations);
+    }
+
+    SECTION("derived classes use the global heap")
+    {
+        ObjectPoolStatistics before = GetPoolStatistics("PooledObject");
+        std::unique_ptr<PooledObject> derived = std::make_unique<LargerPooledObject>();
+        derived.reset();
+        ObjectPoolStatistics after = GetPoolStatistics("PooledObject");
+        REQUIRE(after.Allocations == before.Allocations);
+    }
+
+    SECTION("objects freed on another thread")
+    {
+        std::vector<PooledObject*> objects;
+        for (uint32 i = 0; i < 500; ++i)
+            objects.push_back(new PooledObject());
+
+        ObjectPoolStatistics before = GetPoolStatistics("PooledObject");
+
+        std::thread([&]()
+        {
+            for (PooledObject* object : objects)
+                delete object;
+        }).join();
+
+        ObjectPoolStatistics after = GetPoolStatistics("PooledObject");
+        REQUIRE(after.Deallocations - before.Deallocations == 500);
+
+        // the other thread returned its cache on exit, so no new chunks are needed
+        for (uint32 i = 0; i < 500; ++i)
+            objects[i] = new PooledObject();
+        REQUIRE(GetPoolStatistics("PooledObject").Chunks == after.Chunks);
+        for (PooledObject* object : objects)
+            delete object;
+    }
+#endif
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ScratchBufferPool.h"
+
+TEST_CASE("ScratchBufferPool", "[ScratchBufferPool]")
+{
+    ScratchBufferPool<int32> pool(64);
+    REQUIRE(pool.GetFreeCount() == 0);
+
+    SECTION("released buffers are reused empty with their capacity")
+    {
+        int32 const* data = nullptr;
+        {
+            ScratchBufferPool<int32>::Lease lease = pool.Acquire();
+            lease->assign({ 1, 2, 3 });
+            data = lease->data();
+        }
+        REQUIRE(pool.GetFreeCount() == 1);
+
+        ScratchBufferPool<int32>::Lease lease = pool.Acquire();
+        REQUIRE(pool.GetFreeCount() == 0);
+        REQUIRE(lease->empty());
+        REQUIRE(lease->capacity() >= 3);
+        REQUIRE(lease->data() == data);
+    }
+
+    SECTION("nested leases get separate buffers")
+    {
+        ScratchBufferPool<int32>::Lease outer = pool.Acquire();
+        outer->push_back(1);
+        {
+            ScratchBufferPool<int32>::Lease inner = pool.Acquire();
+            inner->push_back(2);
+            REQUIRE(outer->size() == 1);
+        }
+        REQUIRE((*outer)[0] == 1);
+        REQUIRE(pool.GetFreeCount() == 1);
+    }
+
+    SECTION("moved leases release once")
+    {
+        {
+            ScratchBufferPool<int32>::Lease lease = pool.Acquire();
+            ScratchBufferPool<int32>::Lease moved = std::move(lease);
+            moved->push_back(1);
+        }
+        REQUIRE(pool.GetFreeCount() == 1);
+    }
+
+    SECTION("oversized buffers are not kept")
+    {
+        {
+            ScratchBufferPool<int32>::Lease lease = pool.Acquire();
+            lease->resize(1000);
+        }
+        REQUIRE(pool.GetFreeCount() == 0);
+    }
+}
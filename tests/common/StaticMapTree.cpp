@@ -0,0 +1,205 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "tc_catch2.h"
+
+#include "MapTree.h"
+#include "ModelIgnoreFlags.h"
+#include "ModelInstance.h"
+#include "VMapDefinitions.h"
+#include "VMapManager2.h"
+#include "WorldModel.h"
+#include <cstdio>
+#include <filesystem>
+#include <random>
+
+using namespace VMAP;
+
+namespace
+{
+    uint32 const TestMapId = 999;
+    uint32 const TestTileX = 32;
+    uint32 const TestTileY = 32;
+
+    // writes a single tile map made of randomly placed cubes
+    std::string WriteTestMap(uint32 cubeCount)
+    {
+        std::filesystem::path basePath = std::filesystem::temp_directory_path() / "tc_static_map_tree_test";
+        std::filesystem::create_directories(basePath);
+
+        {
+            std::vector<G3D::Vector3> vertices;
+            for (uint32 i = 0; i < 8; ++i)
+                vertices.emplace_back(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f);
+            std::vector<MeshTriangle> triangles =
+            {
+                { 0, 1, 3 }, { 0, 3, 2 }, { 4, 5, 7 }, { 4, 7, 6 }, // z faces
+                { 0, 1, 5 }, { 0, 5, 4 }, { 2, 3, 7 }, { 2, 7, 6 }, // y faces
+                { 0, 2, 6 }, { 0, 6, 4 }, { 1, 3, 7 }, { 1, 7, 5 }  // x faces
+            };
+
+            std::vector<GroupModel> groups;
+            groups.emplace_back(0, 0, G3D::AABox(G3D::Vector3(-1.0f, -1.0f, -1.0f), G3D::Vector3(1.0f, 1.0f, 1.0f)));
+            groups.back().setMeshData(vertices, triangles);
+            WorldModel cube;
+            cube.setGroupModels(groups);
+            REQUIRE(cube.writeFile((basePath / "cube.vmo").string()));
+        }
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> coord(0.0f, 200.0f);
+        std::uniform_real_distribution<float> height(0.0f, 10.0f);
+        std::uniform_real_distribution<float> scale(0.5f, 3.0f);
+
+        std::vector<ModelSpawn> spawns(cubeCount);
+        for (uint32 i = 0; i < cubeCount; ++i)
+        {
+            ModelSpawn& spawn = spawns[i];
+            spawn.flags = MOD_HAS_BOUND;
+            spawn.adtId = 0;
+            spawn.ID = i;
+            spawn.iPos = G3D::Vector3(coord(rng), coord(rng), height(rng));
+            spawn.iRot = G3D::Vector3::zero();
+            spawn.iScale = scale(rng);
+            spawn.iBound = G3D::AABox(spawn.iPos - G3D::Vector3(spawn.iScale, spawn.iScale, spawn.iScale), spawn.iPos + G3D::Vector3(spawn.iScale, spawn.iScale, spawn.iScale));
+            spawn.name = "cube";
+        }
+
+        BIH tree;
+        auto getBounds = [](ModelSpawn const& spawn, G3D::AABox& out) { out = spawn.iBound; };
+        tree.build(spawns, getBounds);
+
+        FILE* mapFile = fopen((basePath / VMapManager2::getMapFileName(TestMapId)).string().c_str(), "wb");
+        REQUIRE(mapFile);
+        char const tiled = 1;
+        fwrite(VMAP_MAGIC, 1, 8, mapFile);
+        fwrite(&tiled, sizeof(char), 1, mapFile);
+        fwrite("NODE", 1, 4, mapFile);
+        REQUIRE(tree.writeToFile(mapFile));
+        fwrite("GOBJ", 1, 4, mapFile);
+        fclose(mapFile);
+
+        FILE* tileFile = fopen((basePath / StaticMapTree::getTileFileName(TestMapId, TestTileX, TestTileY)).string().c_str(), "wb");
+        REQUIRE(tileFile);
+        fwrite(VMAP_MAGIC, 1, 8, tileFile);
+        fwrite(&cubeCount, sizeof(uint32), 1, tileFile);
+        for (uint32 i = 0; i < cubeCount; ++i)
+        {
+            REQUIRE(ModelSpawn::writeToFile(tileFile, spawns[i]));
+            fwrite(&i, sizeof(uint32), 1, tileFile);
+        }
+        fclose(tileFile);
+
+        return basePath.string() + "/";
+    }
+
+    std::vector<std::pair<G3D::Vector3, G3D::Vector3>> MakeAreaSegments(std::mt19937& rng, uint32 count)
+    {
+        // area target selection: segments from every target towards the center of the area
+        std::uniform_real_distribution<float> offset(-30.0f, 30.0f);
+        std::uniform_real_distribution<float> height(0.0f, 10.0f);
+        G3D::Vector3 center(100.0f, 100.0f, 5.0f);
+
+        std::vector<std::pair<G3D::Vector3, G3D::Vector3>> segments;
+        for (uint32 i = 0; i < count; ++i)
+            segments.emplace_back(G3D::Vector3(center.x + offset(rng), center.y + offset(rng), height(rng)), center);
+        return segments;
+    }
+}
+
+TEST_CASE("StaticMapTree batched line of sight", "[StaticMapTree]")
+{
+    std::string basePath = WriteTestMap(300);
+
+    VMapManager2 vmapManager;
+    StaticMapTree mapTree(TestMapId, basePath);
+    REQUIRE(mapTree.InitMap(VMapManager2::getMapFileName(TestMapId), &vmapManager));
+    REQUIRE(mapTree.LoadMapTile(TestTileX, TestTileY, &vmapManager));
+
+    std::mt19937 rng(42);
+
+    SECTION("same results as single segment queries")
+    {
+        for (uint32 iteration = 0; iteration < 20; ++iteration)
+        {
+            std::vector<std::pair<G3D::Vector3, G3D::Vector3>> segments = MakeAreaSegments(rng, 50);
+            std::vector<bool> results;
+            mapTree.isInLineOfSight(segments, results, ModelIgnoreFlags::Nothing);
+            REQUIRE(results.size() == segments.size());
+
+            for (std::size_t i = 0; i < segments.size(); ++i)
+                REQUIRE(results[i] == mapTree.isInLineOfSight(segments[i].first, segments[i].second, ModelIgnoreFlags::Nothing));
+        }
+    }
+
+    SECTION("blocked and clear segments")
+    {
+        std::vector<std::pair<G3D::Vector3, G3D::Vector3>> segments;
+        segments.emplace_back(G3D::Vector3(-50.0f, -50.0f, 50.0f), G3D::Vector3(-60.0f, -50.0f, 50.0f));
+        segments.emplace_back(G3D::Vector3(-50.0f, -50.0f, 50.0f), G3D::Vector3(-50.0f, -50.0f, 50.0f));
+        std::vector<bool> results;
+        mapTree.isInLineOfSight(segments, results, ModelIgnoreFlags::Nothing);
+        CHECK(results[0]);
+        CHECK(results[1]);
+
+        // some segments through the cube field must be blocked
+        bool anyBlocked = false;
+        for (uint32 i = 0; i < 200 && !anyBlocked; ++i)
+        {
+            std::vector<std::pair<G3D::Vector3, G3D::Vector3>> area = MakeAreaSegments(rng, 10);
+            mapTree.isInLineOfSight(area, results, ModelIgnoreFlags::Nothing);
+            anyBlocked = std::find(results.begin(), results.end(), false) != results.end();
+        }
+        CHECK(anyBlocked);
+    }
+
+    mapTree.UnloadMap(&vmapManager);
+}
+
+TEST_CASE("StaticMapTree batched line of sight benchmark", "[.][benchmark][StaticMapTree]")
+{
+    for (uint32 cubeCount : { 100, 300, 2000 })
+    {
+        std::string basePath = WriteTestMap(cubeCount);
+
+        VMapManager2 vmapManager;
+        StaticMapTree mapTree(TestMapId, basePath);
+        REQUIRE(mapTree.InitMap(VMapManager2::getMapFileName(TestMapId), &vmapManager));
+        REQUIRE(mapTree.LoadMapTile(TestTileX, TestTileY, &vmapManager));
+
+        std::mt19937 rng(42);
+        std::vector<std::pair<G3D::Vector3, G3D::Vector3>> segments = MakeAreaSegments(rng, 100);
+        std::vector<bool> results;
+
+        BENCHMARK("single segment queries, " + std::to_string(cubeCount) + " models")
+        {
+            uint32 visible = 0;
+            for (std::pair<G3D::Vector3, G3D::Vector3> const& segment : segments)
+                visible += mapTree.isInLineOfSight(segment.first, segment.second, ModelIgnoreFlags::Nothing);
+            return visible;
+        };
+
+        BENCHMARK("batched query, " + std::to_string(cubeCount) + " models")
+        {
+            mapTree.isInLineOfSight(segments, results, ModelIgnoreFlags::Nothing);
+            return std::count(results.begin(), results.end(), true);
+        };
+
+        mapTree.UnloadMap(&vmapManager);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "tc_catch2.h"
+
+#include "ModelIgnoreFlags.h"
+#include "WorldModel.h"
+#include <cstdio>
+#include <filesystem>
+
+using namespace VMAP;
+
+namespace
+{
+    GroupModel MakeFloor(float z, uint32 wmoId, bool withLiquid)
+    {
+        std::vector<G3D::Vector3> vertices = { { 0.0f, 0.0f, z }, { 10.0f, 0.0f, z }, { 10.0f, 10.0f, z }, { 0.0f, 10.0f, z } };
+        std::vector<MeshTriangle> triangles = { { 0, 1, 2 }, { 0, 2, 3 } };
+
+        GroupModel group(0, wmoId, G3D::AABox(G3D::Vector3(0.0f, 0.0f, z), G3D::Vector3(10.0f, 10.0f, z + 1.0f)));
+        group.setMeshData(vertices, triangles);
+        if (withLiquid)
+        {
+            // 3x3 liquid tiles leave the flags array unaligned
+            WmoLiquid* liquid = new WmoLiquid(3, 3, G3D::Vector3(0.0f, 0.0f, z), 1);
+            std::fill_n(liquid->GetHeightStorage(), 4 * 4, z + 0.5f);
+            std::fill_n(liquid->GetFlagsStorage(), 3 * 3, uint8(1));
+            group.setLiquidData(liquid);
+        }
+        return group;
+    }
+}
+
+TEST_CASE("WorldModel file round trip", "[WorldModel]")
+{
+    std::string const filename = (std::filesystem::temp_directory_path() / "tc_worldmodel_test.vmo").string();
+
+    {
+        std::vector<GroupModel> groups;
+        groups.push_back(MakeFloor(0.0f, 1, true));
+        groups.push_back(MakeFloor(5.0f, 2, false));
+
+        WorldModel model;
+        model.setRootWmoID(42);
+        model.setGroupModels(groups);
+        REQUIRE(model.writeFile(filename));
+    }
+
+    WorldModel model;
+    REQUIRE(model.readFile(filename));
+
+    std::vector<GroupModel> groups;
+    model.getGroupModels(groups);
+    REQUIRE(groups.size() == 2);
+
+    SECTION("group data")
+    {
+        float liquidHeight = 0.0f;
+        CHECK(groups[0].GetWmoID() == 1);
+        CHECK(groups[0].GetLiquidType() == 1);
+        CHECK(groups[0].GetLiquidLevel(G3D::Vector3(5.0f, 5.0f, 0.0f), liquidHeight));
+        CHECK(liquidHeight == 0.5f);
+        CHECK(groups[1].GetWmoID() == 2);
+        CHECK(groups[1].GetLiquidType() == 0);
+
+        std::vector<G3D::Vector3> vertices;
+        std::vector<MeshTriangle> triangles;
+        WmoLiquid* liquid = nullptr;
+        groups[1].getMeshData(vertices, triangles, liquid);
+        REQUIRE(vertices.size() == 4);
+        CHECK(vertices[2] == G3D::Vector3(10.0f, 10.0f, 5.0f));
+        REQUIRE(triangles.size() == 2);
+        CHECK(triangles[1].idx2 == 3);
+        CHECK(liquid == nullptr);
+    }
+
+    SECTION("ray intersection uses the loaded geometry")
+    {
+        G3D::Ray ray = G3D::Ray::fromOriginAndDirection(G3D::Vector3(5.0f, 5.0f, 10.0f), G3D::Vector3(0.0f, 0.0f, -1.0f));
+        float distance = 100.0f;
+        REQUIRE(model.IntersectRay(ray, distance, false, ModelIgnoreFlags::Nothing));
+        CHECK(distance == Approx(5.0f));
+
+        ray = G3D::Ray::fromOriginAndDirection(G3D::Vector3(20.0f, 5.0f, 10.0f), G3D::Vector3(0.0f, 0.0f, -1.0f));
+        distance = 100.0f;
+        CHECK_FALSE(model.IntersectRay(ray, distance, false, ModelIgnoreFlags::Nothing));
+    }
+
+    groups.clear();
+    std::remove(filename.c_str());
+}
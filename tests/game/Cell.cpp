@@ -0,0 +1,83 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "tc_catch2.h"
+
+#include "CellImpl.h"
+#include <random>
+
+namespace
+{
+    float DistanceToCell(float x, float y, uint32 cellX, uint32 cellY)
+    {
+        float minX = (float(cellX) - float(CENTER_GRID_CELL_ID)) * SIZE_OF_GRID_CELL;
+        float minY = (float(cellY) - float(CENTER_GRID_CELL_ID)) * SIZE_OF_GRID_CELL;
+        float dx = std::max({ minX - x, x - (minX + SIZE_OF_GRID_CELL), 0.0f });
+        float dy = std::max({ minY - y, y - (minY + SIZE_OF_GRID_CELL), 0.0f });
+        return std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+TEST_CASE("Cell column span", "[Cell]")
+{
+    SECTION("cells are consistent with ComputeCellCoord")
+    {
+        CellCoord coord = Trinity::ComputeCellCoord(10.0f, -20.0f);
+        CHECK(DistanceToCell(10.0f, -20.0f, coord.x_coord, coord.y_coord) == 0.0f);
+    }
+
+    SECTION("span covers exactly the cells intersecting the circle")
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> coord(-1000.0f, 1000.0f);
+        std::uniform_real_distribution<float> radius(1.0f, 120.0f);
+
+        for (uint32 i = 0; i < 500; ++i)
+        {
+            float x = coord(rng), y = coord(rng), r = radius(rng);
+            CellArea area = Cell::CalculateCellArea(x, y, r);
+
+            for (uint32 cellX = area.low_bound.x_coord; cellX <= area.high_bound.x_coord; ++cellX)
+            {
+                uint32 lowY = 0, highY = 0;
+                bool any = Cell::CalculateColumnSpan(x, y, r, area, cellX, lowY, highY);
+                for (uint32 cellY = area.low_bound.y_coord; cellY <= area.high_bound.y_coord; ++cellY)
+                {
+                    bool visited = any && cellY >= lowY && cellY <= highY;
+                    float distance = DistanceToCell(x, y, cellX, cellY);
+                    // allow for float rounding right at the circle border
+                    if (distance < r - 0.01f)
+                        REQUIRE(visited);
+                    else if (distance > r + 0.01f)
+                        REQUIRE_FALSE(visited);
+                }
+            }
+        }
+    }
+
+    SECTION("bounding square corners are skipped")
+    {
+        // center of a cell, radius spanning two cells in every direction
+        float x = 0.5f * SIZE_OF_GRID_CELL, y = 0.5f * SIZE_OF_GRID_CELL, r = 2.0f * SIZE_OF_GRID_CELL;
+        CellArea area = Cell::CalculateCellArea(x, y, r);
+        uint32 lowY = 0, highY = 0;
+        REQUIRE(Cell::CalculateColumnSpan(x, y, r, area, area.low_bound.x_coord, lowY, highY));
+        CHECK(lowY > area.low_bound.y_coord);
+        CHECK(highY < area.high_bound.y_coord);
+    }
+}
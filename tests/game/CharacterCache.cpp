@@ -0,0 +1,113 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CharacterCache.h"
+#include "SharedDefines.h"
+
+static ObjectGuid MakeGuid(ObjectGuid::LowType counter)
+{
+    return ObjectGuid::Create<HighGuid::Player>(counter);
+}
+
+static void AddCharacter(ObjectGuid::LowType counter, std::string const& name)
+{
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(counter), 1, name, GENDER_MALE, RACE_HUMAN, CLASS_WARRIOR, 1);
+}
+
+TEST_CASE("CharacterCache lookups", "[CharacterCache]")
+{
+    SECTION("Add")
+    {
+        AddCharacter(100001, "Cacheadd");
+
+        CharacterCacheEntry const* entry = sCharacterCache->GetCharacterCacheByGuid(MakeGuid(100001));
+        REQUIRE(entry);
+        REQUIRE(entry->Name == "Cacheadd");
+        REQUIRE(entry->Level == 1);
+        REQUIRE(sCharacterCache->GetCharacterCacheByName("Cacheadd") == entry);
+        REQUIRE(sCharacterCache->GetCharacterGuidByName("Cacheadd") == MakeGuid(100001));
+        REQUIRE(!sCharacterCache->GetCharacterCacheByName("Cacheaddx"));
+
+        sCharacterCache->UpdateCharacterLevel(MakeGuid(100001), 80);
+        REQUIRE(sCharacterCache->GetCharacterLevelByGuid(MakeGuid(100001)) == 80);
+        REQUIRE(sCharacterCache->GetCharacterCacheByName("Cacheadd")->Level == 80);
+    }
+
+    SECTION("Rename")
+    {
+        AddCharacter(100002, "Cacheold");
+        sCharacterCache->UpdateCharacterData(MakeGuid(100002), "Cachenew");
+
+        REQUIRE(!sCharacterCache->GetCharacterCacheByName("Cacheold"));
+        REQUIRE(sCharacterCache->GetCharacterGuidByName("Cachenew") == MakeGuid(100002));
+        REQUIRE(sCharacterCache->GetCharacterCacheByGuid(MakeGuid(100002))->Name == "Cachenew");
+
+        // the old name slot can be claimed by another character
+        AddCharacter(100003, "Cacheold");
+        REQUIRE(sCharacterCache->GetCharacterGuidByName("Cacheold") == MakeGuid(100003));
+    }
+
+    SECTION("Delete and re-add")
+    {
+        AddCharacter(100004, "Cachedel");
+        sCharacterCache->DeleteCharacterCacheEntry(MakeGuid(100004), "Cachedel");
+
+        REQUIRE(!sCharacterCache->HasCharacterCacheEntry(MakeGuid(100004)));
+        REQUIRE(!sCharacterCache->GetCharacterCacheByName("Cachedel"));
+        REQUIRE(sCharacterCache->GetCharacterCacheByNamePrefix("Cachedel", 10).empty());
+
+        AddCharacter(100004, "Cachereadd");
+        REQUIRE(sCharacterCache->GetCharacterCacheByGuid(MakeGuid(100004))->Name == "Cachereadd");
+        REQUIRE(sCharacterCache->GetCharacterGuidByName("Cachereadd") == MakeGuid(100004));
+        REQUIRE(!sCharacterCache->GetCharacterCacheByName("Cachedel"));
+    }
+
+    SECTION("Growth")
+    {
+        // well past 2/3 of the initial capacity
+        for (ObjectGuid::LowType i = 0; i < 5000; ++i)
+            AddCharacter(200000 + i, "Cachegrow" + std::to_string(i));
+
+        for (ObjectGuid::LowType i = 0; i < 5000; ++i)
+        {
+            CharacterCacheEntry const* entry = sCharacterCache->GetCharacterCacheByGuid(MakeGuid(200000 + i));
+            REQUIRE(entry);
+            REQUIRE(entry->Name == "Cachegrow" + std::to_string(i));
+            REQUIRE(sCharacterCache->GetCharacterCacheByName(entry->Name) == entry);
+        }
+    }
+
+    SECTION("Case insensitive prefix")
+    {
+        AddCharacter(100010, "Cacheprefixc");
+        AddCharacter(100011, "Cacheprefixa");
+        AddCharacter(100012, "Cacheprefixb");
+
+        std::vector<CharacterCacheEntry const*> entries = sCharacterCache->GetCharacterCacheByNamePrefix("CACHEPREFIX", 10);
+        REQUIRE(entries.size() == 3);
+        REQUIRE(entries[0]->Name == "Cacheprefixa");
+        REQUIRE(entries[1]->Name == "Cacheprefixb");
+        REQUIRE(entries[2]->Name == "Cacheprefixc");
+
+        REQUIRE(sCharacterCache->GetCharacterCacheByNamePrefix("cacheprefix", 2).size() == 2);
+        REQUIRE(sCharacterCache->GetCharacterCacheByNamePrefix("cacheprefixb", 10).front()->Guid == MakeGuid(100012));
+    }
+
+    sCharacterCache->ReleaseRetiredEntries();
+}
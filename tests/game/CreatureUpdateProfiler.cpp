@@ -0,0 +1,74 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CreatureUpdateProfiler.h"
+#include <thread>
+
+TEST_CASE("CreatureUpdateProfiler", "[CreatureUpdateProfiler]")
+{
+    sCreatureUpdateProfiler->Reset();
+
+    SECTION("disabled records nothing")
+    {
+        sCreatureUpdateProfiler->SetSampleRate(0);
+        {
+            CreatureUpdateProfiler::SampleScope sample(1);
+            CreatureUpdateProfiler::SectionTimer timer(CREATURE_UPDATE_SECTION_AI);
+        }
+        REQUIRE(sCreatureUpdateProfiler->GetStatistics().empty());
+    }
+
+    SECTION("sections are added to the enclosing update")
+    {
+        sCreatureUpdateProfiler->SetSampleRate(1);
+        for (uint32 entry : { 1, 2, 2 })
+        {
+            CreatureUpdateProfiler::SampleScope sample(entry);
+            CreatureUpdateProfiler::SectionTimer ai(CREATURE_UPDATE_SECTION_AI);
+            if (entry == 2)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // sections outside of a creature update are ignored
+        {
+            CreatureUpdateProfiler::SectionTimer motion(CREATURE_UPDATE_SECTION_MOTION);
+        }
+
+        std::thread([]()
+        {
+            CreatureUpdateProfiler::SampleScope sample(2);
+        }).join();
+
+        std::vector<CreatureUpdateCost> statistics = sCreatureUpdateProfiler->GetStatistics();
+        REQUIRE(statistics.size() == 2);
+        REQUIRE(statistics[0].Entry == 2);
+        REQUIRE(statistics[0].Samples == 3);
+        REQUIRE(statistics[0].EstimatedCalls == 3);
+        REQUIRE(statistics[0].Time[CREATURE_UPDATE_SECTION_AI] >= 2000000);
+        REQUIRE(statistics[0].Time[CREATURE_UPDATE_SECTION_TOTAL] >= statistics[0].Time[CREATURE_UPDATE_SECTION_AI]);
+        REQUIRE(statistics[0].Time[CREATURE_UPDATE_SECTION_MOTION] == 0);
+        REQUIRE(statistics[1].Entry == 1);
+        REQUIRE(statistics[1].Samples == 1);
+
+        sCreatureUpdateProfiler->Reset();
+        REQUIRE(sCreatureUpdateProfiler->GetStatistics().empty());
+    }
+
+    sCreatureUpdateProfiler->SetSampleRate(0);
+}
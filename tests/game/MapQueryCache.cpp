@@ -0,0 +1,104 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "MapQueryCache.h"
+#include <limits>
+
+using TestCache = MapQueryCache<float, 3>;
+
+namespace
+{
+    TestCache::Key MakeKey(float& x, float& y, float& z)
+    {
+        TestCache::Key key;
+        REQUIRE(TestCache::Quantize(x, key[0]));
+        REQUIRE(TestCache::Quantize(y, key[1]));
+        REQUIRE(TestCache::Quantize(z, key[2]));
+        return key;
+    }
+}
+
+TEST_CASE("MapQueryCache quantization", "[MapQueryCache]")
+{
+    uint32 key1, key2;
+    float a = 100.001f, b = 100.004f;
+    REQUIRE(TestCache::Quantize(a, key1));
+    REQUIRE(TestCache::Quantize(b, key2));
+    REQUIRE(key1 == key2);
+    REQUIRE(a == b);
+    REQUIRE(a == Approx(100.0f).margin(0.5f / TestCache::QuantizationScale));
+
+    float negative = -2.5f;
+    REQUIRE(TestCache::Quantize(negative, key1));
+    REQUIRE(negative == -2.5f);
+
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    float inf = std::numeric_limits<float>::infinity();
+    REQUIRE_FALSE(TestCache::Quantize(nan, key1));
+    REQUIRE_FALSE(TestCache::Quantize(inf, key1));
+}
+
+TEST_CASE("MapQueryCache lookups", "[MapQueryCache]")
+{
+    TestCache cache(64);
+    REQUIRE(cache.IsEnabled());
+
+    int32 calls = 0;
+    auto query = [&] { ++calls; return 42.0f; };
+
+    float x = 10.0f, y = 20.0f, z = 30.0f;
+    TestCache::Key key = MakeKey(x, y, z);
+
+    SECTION("repeated queries hit")
+    {
+        REQUIRE(cache.Get(key, 1, query) == 42.0f);
+        REQUIRE(cache.Get(key, 1, query) == 42.0f);
+        REQUIRE(calls == 1);
+        REQUIRE(cache.GetHits() == 1);
+        REQUIRE(cache.GetMisses() == 1);
+
+        cache.ResetCounters();
+        REQUIRE(cache.GetHits() == 0);
+        REQUIRE(cache.GetMisses() == 0);
+    }
+
+    SECTION("generation change invalidates")
+    {
+        cache.Get(key, 1, query);
+        cache.Get(key, 2, query);
+        REQUIRE(calls == 2);
+        cache.Get(key, 2, query);
+        REQUIRE(calls == 2);
+    }
+
+    SECTION("different keys don't share results")
+    {
+        float x2 = 10.5f;
+        TestCache::Key other = MakeKey(x2, y, z);
+        REQUIRE(cache.Get(key, 1, [] { return 1.0f; }) == 1.0f);
+        REQUIRE(cache.Get(other, 1, [] { return 2.0f; }) == 2.0f);
+        REQUIRE(cache.Get(key, 1, [] { return 3.0f; }) != 2.0f);
+    }
+
+    SECTION("disabled cache")
+    {
+        TestCache disabled(0);
+        REQUIRE_FALSE(disabled.IsEnabled());
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "OpcodeProfiler.h"
+#include "Opcodes.h"
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("OpcodeProfiler", "[OpcodeProfiler]")
+{
+    sOpcodeProfiler->Reset();
+
+    SECTION("sums threads and sorts by time")
+    {
+        sOpcodeProfiler->Record(CMSG_PING, 100ns, 8);
+        std::thread([]()
+        {
+            sOpcodeProfiler->Record(CMSG_PING, 300ns, 8);
+            sOpcodeProfiler->Record(CMSG_MESSAGECHAT, 2us, 40);
+        }).join();
+
+        std::vector<OpcodeProfileEntry> statistics = sOpcodeProfiler->GetStatistics();
+        REQUIRE(statistics.size() == 2);
+        REQUIRE(statistics[0].Opcode == CMSG_MESSAGECHAT);
+        REQUIRE(statistics[0].Bytes == 40);
+        REQUIRE(statistics[1].Opcode == CMSG_PING);
+        REQUIRE(statistics[1].Count == 2);
+        REQUIRE(statistics[1].TotalTime == 400);
+        REQUIRE(statistics[1].MaxTime == 300);
+        REQUIRE(statistics[1].Bytes == 16);
+    }
+
+    SECTION("reset clears every thread")
+    {
+        sOpcodeProfiler->Record(CMSG_PING, 100ns, 8);
+        std::thread([]() { sOpcodeProfiler->Record(CMSG_PING, 100ns, 8); }).join();
+        sOpcodeProfiler->Reset();
+        REQUIRE(sOpcodeProfiler->GetStatistics().empty());
+
+        sOpcodeProfiler->Record(CMSG_PING, 50ns, 8);
+        std::vector<OpcodeProfileEntry> statistics = sOpcodeProfiler->GetStatistics();
+        REQUIRE(statistics.size() == 1);
+        REQUIRE(statistics[0].Count == 1);
+        REQUIRE(statistics[0].MaxTime == 50);
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include <random>
+#include <vector>
+
+namespace
+{
+    // per field selection done by Object::BuildValuesUpdate before the masks were packed, kept as reference
+    std::vector<uint32> SelectFieldsScalar(uint32 fieldCount, std::vector<uint8> const& changed, uint32 visibleFlag, uint32 forcedFlags)
+    {
+        std::vector<uint32> selected;
+        for (uint32 index = 0; index < fieldCount; ++index)
+            if ((UnitUpdateFieldFlags[index] & forcedFlags) || (changed[index] && (UnitUpdateFieldFlags[index] & visibleFlag)))
+                selected.push_back(index);
+        return selected;
+    }
+
+    std::vector<uint32> SelectFieldsPacked(uint32 fieldCount, UpdateMask const& changed, uint32 visibleFlag, uint32 forcedFlags)
+    {
+        std::array<UpdateMask::BlockType, UpdateFieldFlagMasks::MAX_BLOCKS> visible = { };
+        std::array<UpdateMask::BlockType, UpdateFieldFlagMasks::MAX_BLOCKS> forced = { };
+        UpdateFieldFlagMasks const& flagMasks = UpdateFieldFlagMasks::Get(UnitUpdateFieldFlags);
+        flagMasks.Collect(visibleFlag, visible.data(), UpdateMask::GetBlockCount(fieldCount));
+        flagMasks.Collect(forcedFlags, forced.data(), UpdateMask::GetBlockCount(fieldCount));
+
+        UpdateMaskPacketBuilder builder(fieldCount);
+        builder.SetBlocks(changed.GetBlocks(), visible.data(), forced.data(), fieldCount);
+
+        std::vector<uint32> selected;
+        for (uint32 index = builder.FindNextSetBit(0); index < fieldCount; index = builder.FindNextSetBit(index + 1))
+            selected.push_back(index);
+        return selected;
+    }
+
+    struct ChangedFields
+    {
+        ChangedFields(uint32 fieldCount, uint32 changeCount, uint32 seed) : Bytes(fieldCount)
+        {
+            Mask.SetCount(fieldCount);
+            std::mt19937 rng(seed);
+            std::uniform_int_distribution<uint32> field(0, fieldCount - 1);
+            for (uint32 i = 0; i < changeCount; ++i)
+            {
+                uint32 index = field(rng);
+                Bytes[index] = 1;
+                Mask.SetBit(index);
+            }
+        }
+
+        std::vector<uint8> Bytes;
+        UpdateMask Mask;
+    };
+
+    constexpr uint32 OtherPlayerVisibility = UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER;
+    constexpr uint32 SelfVisibility = UF_FLAG_PUBLIC | UF_FLAG_PRIVATE | UF_FLAG_OWNER;
+}
+
+TEST_CASE("UpdateMask bit operations", "[UpdateMask]")
+{
+    UpdateMask mask;
+    mask.SetCount(PLAYER_END);
+
+    mask.SetBit(0);
+    mask.SetBit(31);
+    mask.SetBit(32);
+    mask.SetBit(PLAYER_END - 1);
+    REQUIRE(mask.GetBit(0));
+    REQUIRE(mask.GetBit(31));
+    REQUIRE(mask.GetBit(32));
+    REQUIRE(mask.GetBit(PLAYER_END - 1));
+    REQUIRE_FALSE(mask.GetBit(1));
+
+    mask.UnsetBit(31);
+    REQUIRE_FALSE(mask.GetBit(31));
+    REQUIRE(mask.GetBit(32));
+
+    mask.Clear();
+    REQUIRE_FALSE(mask.GetBit(0));
+    REQUIRE_FALSE(mask.GetBit(PLAYER_END - 1));
+}
+
+TEST_CASE("Packed field selection matches per field selection", "[UpdateMask]")
+{
+    for (uint32 fieldCount : { uint32(UNIT_END), uint32(PLAYER_END) })
+    {
+        for (uint32 seed = 0; seed < 20; ++seed)
+        {
+            ChangedFields changed(fieldCount, seed * 10, seed);
+            for (uint32 visibleFlag : { uint32(UF_FLAG_PUBLIC), OtherPlayerVisibility, SelfVisibility, SelfVisibility | UF_FLAG_SPECIAL_INFO })
+            {
+                uint32 forcedFlags = UF_FLAG_DYNAMIC | (visibleFlag & UF_FLAG_SPECIAL_INFO);
+                REQUIRE(SelectFieldsPacked(fieldCount, changed.Mask, visibleFlag, forcedFlags) == SelectFieldsScalar(fieldCount, changed.Bytes, visibleFlag, forcedFlags));
+            }
+        }
+    }
+}
+
+TEST_CASE("UpdateMask field selection", "[.][benchmark][UpdateMask]")
+{
+    // a player moving in combat: a few dozen fields change per tick and are sent to 50 nearby players
+    constexpr uint32 Recipients = 50;
+
+    for (auto [name, fieldCount] : { std::pair<char const*, uint32>("Creature", UNIT_END), std::pair<char const*, uint32>("Player", PLAYER_END) })
+    {
+        ChangedFields changed(fieldCount, 40, fieldCount);
+
+        BENCHMARK(std::string(name) + " per field")
+        {
+            std::size_t selected = 0;
+            for (uint32 i = 0; i < Recipients; ++i)
+                selected += SelectFieldsScalar(fieldCount, changed.Bytes, OtherPlayerVisibility, UF_FLAG_DYNAMIC).size();
+            return selected;
+        };
+
+        BENCHMARK(std::string(name) + " packed")
+        {
+            std::size_t selected = 0;
+            for (uint32 i = 0; i < Recipients; ++i)
+                selected += SelectFieldsPacked(fieldCount, changed.Mask, OtherPlayerVisibility, UF_FLAG_DYNAMIC).size();
+            return selected;
+        };
+    }
+}